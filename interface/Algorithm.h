@@ -16,6 +16,7 @@
 #include "bsm_input/interface/bsm_input_fwd.h"
 #include "interface/bsm_fwd.h"
 #include "interface/DecayGenerator.h"
+#include "interface/SmallVector.h"
 #include "interface/SynchSelector.h"
 
 namespace bsm
@@ -48,8 +49,9 @@ namespace bsm
     class NeutrinoReconstruct : public core::Object
     {
         public:
-            typedef boost::shared_ptr<LorentzVector> LorentzVectorPtr;
-            typedef std::vector<LorentzVectorPtr> Solutions;
+            // At most two solutions are found
+            //
+            typedef SmallVector<LorentzVector, 2> Solutions;
 
             NeutrinoReconstruct();
             NeutrinoReconstruct(const NeutrinoReconstruct &);
@@ -186,7 +188,7 @@ namespace bsm
                 LorentzVector wlep;
                 LorentzVector whad;
                 LorentzVector neutrino;     // Selected MET solution
-                LorentzVectors neutrinos;   // All MET solutions
+                NeutrinoReconstruct::Solutions neutrinos; // All MET solutions
                 LorentzVector ltop;
                 LorentzVector htop;
 
@@ -204,10 +206,52 @@ namespace bsm
                 bool valid;
             };
 
+            typedef NeutrinoReconstruct::Solutions Neutrinos;
+
+            // Search for the best solution among hypotheses of one event.
+            // Hypotheses and neutrino solutions may be shared between
+            // several reconstructors
+            //
+            class Search
+            {
+                public:
+                    virtual ~Search()
+                    {
+                    }
+
+                    // Hypothesis is shared and refilled between calls:
+                    // search should not keep references to it
+                    //
+                    virtual void add(const Generator &,
+                                     const Generator::Hypothesis &) = 0;
+
+                    // Best solution. Neutrino solutions are not filled
+                    //
+                    virtual Mttbar result() const = 0;
+            };
+
+            typedef boost::shared_ptr<Search> SearchPtr;
+
+            ResonanceReconstructor();
+
             virtual Mttbar run(const LorentzVector &lepton,
                                const LorentzVector &met,
                                const SynchSelector::GoodJets &) const;
 
+            // Start search in the event. Lepton, neutrinos and generator
+            // objects should not change until the search is done
+            //
+            virtual SearchPtr search(const LorentzVector &lepton,
+                                     const Neutrinos &,
+                                     const Generator &) const;
+
+            // Only leading jets are assigned to the top legs in hypotheses,
+            // the rest of jets are neutral. Zero means all jets (up to the
+            // generator limit)
+            //
+            void setMaxJets(const uint32_t &);
+            uint32_t maxJets() const;
+
             // Object interface
             //
             virtual void print(std::ostream &) const;
@@ -234,6 +278,55 @@ namespace bsm
                     const LorentzVector &ltop,
                     const LorentzVector &htop,
                     const Iterators &htop_jets) const = 0;
+
+        private:
+            class DiscriminatorSearch;
+
+            uint32_t _max_jets;
+    };
+
+    // Run several reconstructors over one enumeration of the neutrino
+    // solutions and jets hypotheses per event. Each reconstructor applies
+    // its own validity checks and discriminators
+    //
+    class MultiResonanceReconstructor: public core::Object
+    {
+        public:
+            typedef boost::shared_ptr<ResonanceReconstructor>
+                ResonanceReconstructorPtr;
+            typedef std::vector<ResonanceReconstructorPtr> Reconstructors;
+            typedef ResonanceReconstructor::Mttbar Mttbar;
+            typedef std::vector<Mttbar> Mttbars;
+
+            MultiResonanceReconstructor();
+            MultiResonanceReconstructor(const MultiResonanceReconstructor &);
+
+            void add(const ResonanceReconstructorPtr &);
+
+            const Reconstructors &reconstructors() const;
+
+            // Jets cap is shared by all reconstructors
+            //
+            void setMaxJets(const uint32_t &);
+            uint32_t maxJets() const;
+
+            // Results are in the same order as reconstructors
+            //
+            Mttbars run(const LorentzVector &lepton,
+                        const LorentzVector &met,
+                        const SynchSelector::GoodJets &) const;
+
+            // Object interface
+            //
+            virtual uint32_t id() const;
+            virtual ObjectPtr clone() const;
+
+            virtual void print(std::ostream &) const;
+
+        private:
+            Reconstructors _reconstructors;
+
+            uint32_t _max_jets;
     };
 
     class SimpleResonanceReconstructor: public ResonanceReconstructor
@@ -268,6 +361,10 @@ namespace bsm
                     const LorentzVector &ltop,
                     const LorentzVector &htop,
                     const Iterators &htop_jets) const;
+
+            // Jet that is used by getLeptonicJet
+            //
+            const CorrectedJet *findLeptonicJet(const Iterators &) const;
     };
 
     class BtagResonanceReconstructor: public SimpleResonanceReconstructor
@@ -294,7 +391,7 @@ namespace bsm
 
         private:
             uint32_t countBtags(const Iterators &) const;
-            bool isBtagJet(const Jet *jet) const;
+            bool isBtagJet(const CorrectedJet &) const;
     };
 
     class SimpleDrResonanceReconstructor: public SimpleResonanceReconstructor
@@ -514,6 +611,10 @@ namespace bsm
 
         bool valid;
 
+        // Decay generator hypothesis index
+        //
+        uint64_t index;
+
         float ltop_chi2;
         LorentzVector ltop;
         LorentzVector lepton;
@@ -541,6 +642,23 @@ namespace bsm
 
             virtual float calculate(const Chi2Hypothesis &) const = 0;
 
+            // Relative cost of the calculation: discriminators are applied
+            // cheapest first
+            //
+            virtual uint32_t cost() const
+            {
+                return 1;
+            }
+
+            // Leptonic discriminators use only lepton, neutrino and leptonic
+            // jet and do not depend on the hadronic leg. Discriminators are
+            // assumed to use the hadronic leg unless stated otherwise
+            //
+            virtual bool isLeptonic() const
+            {
+                return false;
+            }
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -568,6 +686,11 @@ namespace bsm
 
             virtual float calculate(const Chi2Hypothesis &hypothesis) const;
 
+            virtual bool isLeptonic() const
+            {
+                return true;
+            }
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -616,6 +739,16 @@ namespace bsm
 
             virtual float calculate(const Chi2Hypothesis &hypothesis) const;
 
+            virtual uint32_t cost() const
+            {
+                return 3;
+            }
+
+            virtual bool isLeptonic() const
+            {
+                return true;
+            }
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -632,6 +765,11 @@ namespace bsm
 
             virtual float calculate(const Chi2Hypothesis &hypothesis) const;
 
+            virtual uint32_t cost() const
+            {
+                return 4;
+            }
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -644,29 +782,62 @@ namespace bsm
             typedef boost::shared_ptr<Chi2Discriminator> Chi2DiscriminatorPtr;
             typedef std::vector<Chi2DiscriminatorPtr> Chi2Discriminators;
             
-            Chi2ResonanceReconstructor()
-            {
-            }
-
+            Chi2ResonanceReconstructor();
             Chi2ResonanceReconstructor(const Chi2ResonanceReconstructor &object);
 
             // Object interface
             //
             virtual uint32_t id() const;
             virtual ObjectPtr clone() const;
+            virtual void merge(const ObjectPtr &);
 
             virtual void print(std::ostream &) const;
 
-            virtual Mttbar run(const LorentzVector &lepton,
-                               const LorentzVector &met,
-                               const SynchSelector::GoodJets &) const;
+            // Hypotheses are scored with a running bound: a candidate is
+            // abandoned as soon as its partial chi2 is worse than the best
+            // one found so far. The result is the same as with all
+            // discriminators evaluated for every candidate
+            //
+            virtual SearchPtr search(const LorentzVector &lepton,
+                                     const Neutrinos &,
+                                     const Generator &) const;
 
+            // Discriminators are reordered cheapest first
+            //
             void setLtopDiscriminators(const Chi2Discriminators &);
             void setHtopDiscriminators(const Chi2Discriminators &);
 
+            // Number of scored (hypothesis, neutrino) candidates and the
+            // number of candidates abandoned before all discriminators
+            // were evaluated
+            //
+            uint64_t candidates() const;
+            uint64_t pruned() const;
+
         private:
+            class Chi2Search;
+
+            // Sum discriminators while the sum does not exceed the bound.
+            // Return false if summation was abandoned
+            //
+            bool chi2(float &,
+                      const Chi2Discriminators &,
+                      const Chi2Hypothesis &,
+                      const float &bound) const;
+
+            static bool isCheaper(const Chi2DiscriminatorPtr &,
+                                  const Chi2DiscriminatorPtr &);
+
             Chi2Discriminators _ltop_discriminators;
             Chi2Discriminators _htop_discriminators;
+
+            // All ltop discriminators are leptonic: ltop chi2 is computed
+            // once per leptonic jet and neutrino solution
+            //
+            bool _is_leptonic_ltop;
+
+            mutable uint64_t _candidates;
+            mutable uint64_t _pruned;
     };
 }
 
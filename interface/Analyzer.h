@@ -13,6 +13,7 @@
 
 #include "bsm_core/interface/Object.h"
 #include "bsm_input/interface/bsm_input_fwd.h"
+#include "interface/bsm_fwd.h"
 
 namespace bsm
 {
@@ -21,6 +22,14 @@ namespace bsm
         public:
             virtual void onFileOpen(const std::string &, const Input *) = 0;
             virtual void process(const Event *) = 0;
+
+            // Products written by AppController into the output file.
+            // Analyzers without registered products return 0
+            //
+            virtual const OutputRegistry *outputs() const
+            {
+                return 0;
+            }
     };
 }
 
@@ -92,6 +92,7 @@ namespace bsm
 
             void setInteractive(const bool &);
             void setOutput(const std::string &);
+            void setSnapshotInterval(const uint32_t &);
 
             void processSingleThread();
             void processMultiThread();
@@ -117,6 +118,8 @@ namespace bsm
             std::string _output_filename;
             TFilePtr _output;
 
+            uint32_t _snapshot_interval;
+
             ReaderDelegate *_reader_delegate;
     };
 }
@@ -0,0 +1,103 @@
+// Poisson bootstrap
+//
+// Every event enters N replicas of the selected histograms with independent
+// Poisson(1) weights. Weights are drawn from the seed built out of the
+// event run, lumi and id: the same event always gets the same weights
+// independently of the thread, job splitting or order of events
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_BOOTSTRAP
+#define BSM_BOOTSTRAP
+
+#include <iosfwd>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "bsm_core/interface/Object.h"
+
+namespace bsm
+{
+    class Bootstrap
+    {
+        public:
+            typedef std::vector<uint8_t> Weights;
+
+            // Bootstrap is disabled with zero replicas
+            //
+            Bootstrap(const uint32_t &replicas = 0);
+
+            bool isEnabled() const;
+            uint32_t replicas() const;
+
+            // Draw replica weights of the event
+            //
+            void setEvent(const uint32_t &run,
+                          const uint32_t &lumi,
+                          const uint32_t &event);
+
+            const Weights &weights() const;
+
+        private:
+            uint32_t _replicas;
+            Weights _weights;
+    };
+
+    // Replicas of one histogram. Contents are kept in a single bin-major
+    // array, [bin * replicas + replica]: all replicas of a bin are next to
+    // each other and one fill updates one contiguous block. Replica-major
+    // layout would keep every replica histogram contiguous but spread each
+    // fill over N cache lines. Bin 0 is underflow, bin N + 1 is overflow
+    //
+    class BootstrapH1 : public core::Object
+    {
+        public:
+            BootstrapH1(const uint32_t &replicas,
+                        const uint32_t &bins,
+                        const float &min,
+                        const float &max);
+
+            // Value is added to every replica with the replica weight
+            // scaled by the event weight
+            //
+            void fill(const Bootstrap &,
+                      const double &x,
+                      const double &weight = 1);
+
+            uint32_t replicas() const;
+            uint32_t bins() const;
+            float min() const;
+            float max() const;
+
+            // Bins are numbered from 0 (underflow) to bins + 1 (overflow)
+            //
+            double content(const uint32_t &replica, const uint32_t &bin) const;
+
+            // Object interface
+            //
+            virtual uint32_t id() const;
+
+            virtual ObjectPtr clone() const;
+            virtual void merge(const ObjectPtr &);
+
+            virtual void print(std::ostream &) const;
+
+        private:
+            typedef std::vector<double> Contents;
+
+            uint32_t bin(const double &x) const;
+
+            uint32_t _replicas;
+            uint32_t _bins;
+            float _min;
+            float _max;
+
+            Contents _contents;
+    };
+
+    typedef boost::shared_ptr<BootstrapH1> BootstrapH1Ptr;
+}
+
+#endif
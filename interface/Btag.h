@@ -12,6 +12,7 @@
 #include "interface/bsm_fwd.h"
 #include "interface/AppController.h"
 #include "interface/DelegateManager.h"
+#include "interface/LookupTable.h"
 
 namespace bsm
 {
@@ -70,10 +71,9 @@ namespace bsm
             virtual float value_minus(const float &x) const = 0;
 
         protected:
-            const uint32_t find_bin(const float &jet_pt) const;
-
-        private:
-            std::vector<float> _bins;
+            // Jet pT binned table: subclasses fill the planes they use
+            //
+            LookupTable _table;
     };
 
     class BtagScale: public BtagFunction
@@ -97,9 +97,6 @@ namespace bsm
 
         protected:
             virtual float error(const float &jet_pt) const;
-
-        private:
-            std::vector<float> _errors;
     };
 
     class CtagScale: public BtagScale
@@ -136,9 +133,6 @@ namespace bsm
             {
                 return value(jet_pt);
             }
-
-        private:
-            std::vector<float> _values;
     };
 
     class CtagEfficiency: public BtagEfficiency
@@ -150,11 +144,6 @@ namespace bsm
         // Errors are not provided ... yet
         public:
             LightEfficiency();
-
-            virtual float value(const float &jet_pt) const;
-
-        private:
-            std::vector<float> _values;
     };
 
     class LightEfficiencyData: public BtagEfficiency
@@ -11,6 +11,7 @@
 #include "bsm_stat/interface/bsm_stat_fwd.h"
 #include "interface/bsm_fwd.h"
 #include "interface/Analyzer.h"
+#include "interface/OutputRegistry.h"
 
 namespace bsm
 {
@@ -37,6 +38,8 @@ namespace bsm
             virtual void onFileOpen(const std::string &filename, const Input *);
             virtual void process(const Event *);
 
+            virtual const OutputRegistry *outputs() const;
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -56,6 +59,8 @@ namespace bsm
 
             bool _use_pileup;
             float _pileup_weight;
+
+            OutputRegistry _outputs;
     };
 }
 
@@ -1,6 +1,9 @@
 // Corrected jet structure: reference to the original jet, subtracted leptons,
 // p4 after subtractions and corrected p4.
 //
+// Jets are plain values: they are kept in per-event buffers and reused
+// without any allocation for the four-vectors
+//
 // Created by Samvel Khalatyan, Jul 31, 2011
 // Copyright 2011, All rights reserved
 
@@ -9,40 +12,54 @@
 
 #include <vector>
 
-#include <boost/shared_ptr.hpp>
-
 #include "bsm_input/interface/bsm_input_fwd.h"
+#include "bsm_input/interface/Physics.pb.h"
 
 namespace bsm
 {
     struct CorrectedJet
     {
-        typedef boost::shared_ptr<LorentzVector> LorentzVectorPtr;
-
         typedef std::vector<const Electron *> Electrons;
         typedef std::vector<const Muon *> Muons;
 
         CorrectedJet():
-            correction(0)
+            jet(0),
+            correction(0),
+            corrected_pt(0),
+            corrected_eta(0),
+            corrected_phi(0),
+            has_csv(false),
+            csv(0),
+            has_ssvhe(false),
+            ssvhe(0)
         {
-            jet = 0;
         }
 
+        // Start correction of a new jet: corrected p4 is set to the jet
+        // uncorrected p4 and b-tag discriminators are resolved
+        //
+        void reset(const Jet *);
+
+        // Cache kinematics of the corrected p4: should be called every
+        // time corrected_p4 changes
+        //
+        void update();
+
         // reference to the origal jet
         //
         const Jet *jet;
 
         // Corrected jet p4
         //
-        LorentzVectorPtr corrected_p4;
+        LorentzVector corrected_p4;
 
         // Corrected MET p4
         //
-        LorentzVectorPtr corrected_met;
+        LorentzVector corrected_met;
 
         // jet uncorrected p4 after leptons subtraction
         //
-        LorentzVectorPtr subtracted_p4;
+        LorentzVector subtracted_p4;
 
         // electrons that were subtracted
         //
@@ -55,6 +72,20 @@ namespace bsm
         // Jet energy correction that was applied
         //
         float correction;
+
+        // Cached corrected p4 kinematics
+        //
+        float corrected_pt;
+        float corrected_eta;
+        float corrected_phi;
+
+        // Cached b-tag discriminators
+        //
+        bool has_csv;
+        float csv;
+
+        bool has_ssvhe;
+        float ssvhe;
     };
 }
 
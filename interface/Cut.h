@@ -32,6 +32,11 @@ namespace bsm
     // unlocked. If counter is locked, then any attempt to modify it will
     // silently be skipped. Counter may also lock itself on update.
     //
+    // Counter keeps the raw number of counts (64 bits) together with the sum
+    // of weights and sum of weights squared. Each update uses the current
+    // counter weight, which is 1 by default and may be changed at any time,
+    // e.g. once per event. Merge adds all three sums exactly.
+    //
     class Counter : public core::Object
     {
         public:
@@ -43,8 +48,18 @@ namespace bsm
 
             // Get number of counts
             //
-            operator uint32_t() const; // obsolete: do not use
-            uint32_t counts() const; // replacement for the convertion
+            operator uint64_t() const; // obsolete: do not use
+            uint64_t counts() const; // replacement for the convertion
+
+            // Weighted counts
+            //
+            double sumOfWeights() const;
+            double sumOfWeights2() const;
+
+            // Weight to be used in the following updates
+            //
+            double weight() const;
+            void setWeight(const double &);
 
             // Status check
             //
@@ -66,7 +81,7 @@ namespace bsm
 
             // Increase counter
             //
-            void add(const uint32_t &counts = 1);
+            void add(const uint64_t &counts = 1);
 
             // Object interface
             //
@@ -81,7 +96,11 @@ namespace bsm
             virtual void print(std::ostream &) const;
 
         private:
-            uint32_t _counts;
+            uint64_t _counts;
+            double _sum_of_weights;
+            double _sum_of_weights2;
+
+            double _weight;
 
             bool _is_locked;
             bool _is_lock_on_update;
@@ -129,6 +148,17 @@ namespace bsm
             //
             virtual bool apply(const float &);
 
+            // apply cut to all values with mask set and update the mask.
+            // Objects counter is increased by the number of passed values,
+            // events counter - by one if any value passed. Return number of
+            // selected values
+            //
+            uint32_t apply(const CutValues &, SelectionMask &);
+
+            // Set weight of the objects and events counters
+            //
+            virtual void setWeight(const double &);
+
             // Disable cut: apply method will always return True
             //
             virtual void disable();
@@ -168,6 +198,14 @@ namespace bsm
             //
             virtual bool isPass(const float &) = 0;
 
+            // Batch cut implementation: store result for each value. Default
+            // implementation calls isPass for each value. Children may
+            // override it with a tight loop that compiler can vectorize
+            //
+            virtual void isPassArray(const float *values,
+                                     const uint32_t &size,
+                                     uint8_t *result);
+
             float _value;       // cut value
             std::string _name;  // cut name
             bool _is_disabled;
@@ -175,6 +213,8 @@ namespace bsm
 
             CounterPtr _objects;    // Counter of objects
             CounterPtr _events;     // Counter of events
+
+            SelectionMask _pass;    // batch apply buffer
     };
 
 
@@ -254,6 +294,10 @@ namespace bsm
                 //
                 virtual bool isPass(const float &number);
 
+                virtual void isPassArray(const float *values,
+                                         const uint32_t &size,
+                                         uint8_t *result);
+
             private:
                 Compare _functor;
         };
@@ -331,6 +375,8 @@ namespace bsm
                 //
                 virtual void setName(const std::string &);
 
+                virtual void setWeight(const double &);
+
                 virtual void disable();
                 virtual void enable();
 
@@ -407,6 +453,18 @@ template<class Compare>
     return functor()(number, value());
 }
 
+template<class Compare>
+    void bsm::Comparator<Compare>::isPassArray(const float *values,
+            const uint32_t &size,
+            uint8_t *result)
+{
+    // Functor is inlined: loop is branch-free and may be vectorized
+    //
+    const float cut_value = value();
+    for(uint32_t i = 0; size > i; ++i)
+        result[i] = _functor(values[i], cut_value);
+}
+
 
 
 // Range Comparator Template implementation
@@ -476,6 +534,17 @@ template<class LowerCompare, class UpperCompare, class Logic>
     upperCut()->setName(name);
 }
 
+template<class LowerCompare, class UpperCompare, class Logic>
+    void bsm::RangeComparator<LowerCompare,
+        UpperCompare,
+        Logic>::setWeight(const double &weight)
+{
+    Cut::setWeight(weight);
+
+    lowerCut()->setWeight(weight);
+    upperCut()->setWeight(weight);
+}
+
 template<class LowerCompare, class UpperCompare, class Logic>
     void bsm::RangeComparator<LowerCompare,
         UpperCompare,
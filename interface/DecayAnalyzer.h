@@ -13,6 +13,8 @@
 #include "bsm_input/interface/GenParticle.pb.h"
 #include "bsm_stat/interface/bsm_stat_fwd.h"
 #include "interface/Analyzer.h"
+#include "interface/GenDecay.h"
+#include "interface/OutputRegistry.h"
 #include "interface/bsm_fwd.h"
 
 namespace bsm
@@ -37,6 +39,10 @@ namespace bsm
             const H2Ptr decay_level_4() const;
             const H2Ptr decay_level_5() const;
 
+            // Histograms written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -47,17 +53,20 @@ namespace bsm
             virtual void print(std::ostream &) const;
 
         private:
-            typedef ::google::protobuf::RepeatedPtrField<GenParticle> GenParticles;
+            // Register output histograms: called by every constructor once
+            // histograms are booked or cloned
+            //
+            void registerOutputs();
 
-            void genParticles(const GenParticles &,
-                    const GenParticle *parent = 0,
-                    const uint32_t &level = 0);
+            GenDecay _gen_decay;
 
             H2ProxyPtr _decay_level_1;
             H2ProxyPtr _decay_level_2;
             H2ProxyPtr _decay_level_3;
             H2ProxyPtr _decay_level_4;
             H2ProxyPtr _decay_level_5;
+
+            OutputRegistry _outputs;
     };
 }
 
@@ -1,24 +1,70 @@
 // costruct TTbar Hypotheses given lepton, neutrino and jets
 //
+// Each object is assigned to the leptonic, hadronic or neutral leg.
+// Hypotheses are enumerated in the reflected ternary Gray code order: only
+// one object moves to a neighbouring leg between consecutive hypotheses.
+// Legs are kept as bitmasks and legs p4 are updated with one subtraction
+// and one addition per step.
+//
+// Every hypothesis is identified with an index: base-3 number where digit
+// i is the leg of object i
+//
 // Created by Samvel Khalatyan, Aug 14, 2011
 // Copyright 2011, All rights reserved
 
 #ifndef BSM_TTBAR_HYPOTHESIS
 #define BSM_TTBAR_HYPOTHESIS
 
-#include <cmath>
 #include <vector>
 
+#include <stdint.h>
+
 #include "bsm_input/interface/bsm_input_fwd.h"
+#include "bsm_input/interface/Algebra.h"
+#include "bsm_input/interface/Physics.pb.h"
+#include "interface/CorrectedJet.h"
+#include "interface/SmallVector.h"
 
 namespace bsm
 {
+    // Four-vector of the object that is summed in the legs
+    //
+    inline const LorentzVector &decayP4(const CorrectedJet &jet)
+    {
+        return jet.corrected_p4;
+    }
+
     template<typename T>
     class DecayGenerator
     {
         public:
             typedef std::vector<T> Objects;
-            typedef std::vector<typename Objects::const_iterator> Iterators;
+
+            // Legs are kept inline up to LEG_OBJECTS objects
+            //
+            enum
+            {
+                LEG_OBJECTS = 10
+            };
+
+            typedef SmallVector<typename Objects::const_iterator,
+                                LEG_OBJECTS> Iterators;
+
+            enum Leg
+            {
+                LEPTONIC = 0,
+                HADRONIC,
+                NEUTRAL,
+
+                LEGS
+            };
+
+            // 3^40 is the largest number of hypotheses that fits 64 bits
+            //
+            enum
+            {
+                MAX_OBJECTS = 40
+            };
 
             struct Hypothesis
             {
@@ -33,91 +79,232 @@ namespace bsm
                 Iterators neutral;
             };
 
-            DecayGenerator();
+            // Only first max_objects are assigned to legs. The rest are
+            // always neutral
+            //
+            DecayGenerator(const uint32_t &max_objects = MAX_OBJECTS);
 
+            // Objects are not copied: hypotheses refer to the passed
+            // container which should not change until generator is done
+            //
             void init(const Objects &objects);
 
             bool next();
 
+            const T &object(const uint32_t &object) const
+            {
+                return (*_objects)[object];
+            }
+
+            // Number of objects assigned to legs
+            //
+            uint32_t objects() const
+            {
+                return _size;
+            }
+
+            uint64_t hypotheses() const
+            {
+                return _hypotheses;
+            }
+
+            uint64_t index() const
+            {
+                return _index;
+            }
+
+            Leg leg(const uint32_t &object) const
+            {
+                return static_cast<Leg>(_legs[object]);
+            }
+
+            uint64_t mask(const Leg &leg) const
+            {
+                return _masks[leg];
+            }
+
+            uint32_t size(const Leg &leg) const
+            {
+                return _sizes[leg];
+            }
+
+            // Sum of objects p4 in the leg
+            //
+            const LorentzVector &p4(const Leg &leg) const
+            {
+                return _p4[leg];
+            }
+
+            // Fill hypothesis reusing its containers. Objects are ordered
+            // the same way as in input
+            //
+            void hypothesis(Hypothesis &) const;
             Hypothesis hypothesis() const;
 
         private:
-            bool isValid() const;
+            const Objects *_objects;
+
+            uint32_t _max_objects;
+            uint32_t _size;
+
+            uint64_t _hypotheses;
+            uint64_t _index;
+            bool _is_done;
 
-            Objects _objects;
+            // Gray code state: digits, directions and focus pointers
+            //
+            uint8_t _legs[MAX_OBJECTS];
+            int8_t _directions[MAX_OBJECTS];
+            uint32_t _focus[MAX_OBJECTS + 1];
+            uint64_t _powers[MAX_OBJECTS];
 
-            uint32_t _number_of_hypotheses;
-            uint32_t _current_hypothesis;
+            uint64_t _masks[LEGS];
+            uint32_t _sizes[LEGS];
+            LorentzVector _p4[LEGS];
     };
 }
 
 template<typename T>
-bsm::DecayGenerator<T>::DecayGenerator():
-    _number_of_hypotheses(0),
-    _current_hypothesis(0)
+bsm::DecayGenerator<T>::DecayGenerator(const uint32_t &max_objects):
+    _objects(0),
+    _max_objects(max_objects && MAX_OBJECTS > max_objects
+            ? max_objects
+            : MAX_OBJECTS),
+    _size(0),
+    _hypotheses(0),
+    _index(0),
+    _is_done(true)
 {
 }
 
 template<typename T>
 void bsm::DecayGenerator<T>::init(const Objects &objects)
 {
-    _objects = objects;
+    _objects = &objects;
+    _size = objects.size() < _max_objects ? objects.size() : _max_objects;
 
-    _number_of_hypotheses = pow(3.0, static_cast<int>(objects.size()));
-    _current_hypothesis = 0;
+    _hypotheses = 1;
+    _index = 0;
+    _is_done = false;
+
+    // Start with all objects assigned to the leptonic leg
+    //
+    for(int leg = 0; LEGS > leg; ++leg)
+    {
+        _masks[leg] = 0;
+        _sizes[leg] = 0;
+        _p4[leg].Clear();
+    }
+
+    for(uint32_t object = 0; _size > object; ++object)
+    {
+        _legs[object] = LEPTONIC;
+        _directions[object] = 1;
+        _focus[object] = object;
+        _powers[object] = _hypotheses;
+
+        _hypotheses *= 3;
+
+        _masks[LEPTONIC] |= 1ull << object;
+        _p4[LEPTONIC] += decayP4(objects[object]);
+    }
+
+    _focus[_size] = _size;
+    _sizes[LEPTONIC] = _size;
 }
 
 template<typename T>
 bool bsm::DecayGenerator<T>::next()
 {
-    if (!isValid())
+    if (_is_done)
+        return false;
+
+    // Loopless reflected Gray code: move the focus object to the
+    // neighbouring leg
+    //
+    const uint32_t object = _focus[0];
+    _focus[0] = 0;
+
+    if (_size == object)
+    {
+        _is_done = true;
+
         return false;
+    }
+
+    const int from = _legs[object];
+    const int to = from + _directions[object];
+
+    _legs[object] = to;
+
+    if (0 < _directions[object])
+        _index += _powers[object];
+    else
+        _index -= _powers[object];
+
+    const uint64_t bit = 1ull << object;
+    _masks[from] &= ~bit;
+    _masks[to] |= bit;
 
-    ++_current_hypothesis;
+    --_sizes[from];
+    ++_sizes[to];
 
-    return isValid();
+    const LorentzVector &p4 = decayP4((*_objects)[object]);
+    _p4[from] -= p4;
+    _p4[to] += p4;
+
+    if (LEPTONIC == to
+            || NEUTRAL == to)
+    {
+        _directions[object] = -_directions[object];
+        _focus[object] = _focus[object + 1];
+        _focus[object + 1] = object + 1;
+    }
+
+    return true;
 }
 
 template<typename T>
-typename bsm::DecayGenerator<T>::Hypothesis bsm::DecayGenerator<T>::hypothesis() const
+void bsm::DecayGenerator<T>::hypothesis(Hypothesis &hypothesis) const
 {
-    Hypothesis hypothesis;
+    hypothesis.leptonic.clear();
+    hypothesis.hadronic.clear();
+    hypothesis.neutral.clear();
 
-    if (isValid())
+    if (!_objects)
+        return;
+
+    typename Objects::const_iterator object = _objects->begin();
+    for(uint32_t i = 0; _size > i; ++i, ++object)
     {
-        uint32_t current_hypothesis = _current_hypothesis;
-        for(typename Objects::const_iterator object = _objects.begin();
-                _objects.end() != object;
-                ++object)
+        switch(_legs[i])
         {
-            switch(current_hypothesis % 3)
-            {
-                case 0: // leptonic
-                    hypothesis.leptonic.push_back(object);
-                    break;
+            case LEPTONIC:
+                hypothesis.leptonic.push_back(object);
+                break;
 
-                case 1: // hadronic
-                    hypothesis.hadronic.push_back(object);
-                    break;
+            case HADRONIC:
+                hypothesis.hadronic.push_back(object);
+                break;
 
-                default:    // none
-                    hypothesis.neutral.push_back(object);
-                    break;
-            }
-
-            current_hypothesis /= 3;        
+            default:
+                hypothesis.neutral.push_back(object);
+                break;
         }
     }
 
-    return hypothesis;
+    for(; _objects->end() != object; ++object)
+        hypothesis.neutral.push_back(object);
 }
 
-// Private
-//
 template<typename T>
-bool bsm::DecayGenerator<T>::isValid() const
+typename bsm::DecayGenerator<T>::Hypothesis
+    bsm::DecayGenerator<T>::hypothesis() const
 {
-    return _number_of_hypotheses > _current_hypothesis;
+    Hypothesis hypothesis;
+    this->hypothesis(hypothesis);
+
+    return hypothesis;
 }
 
 #endif
@@ -0,0 +1,112 @@
+// Per-event kinematics cache
+//
+// pt, eta and phi of the selected leptons, jets and MET are calculated once
+// per event and kept as structure-of-arrays. Lepton-jet distances are
+// calculated in one batch for all pairs on the first request
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_EVENT_KINEMATICS
+#define BSM_EVENT_KINEMATICS
+
+#include <vector>
+
+#include "bsm_input/interface/bsm_input_fwd.h"
+#include "interface/bsm_fwd.h"
+#include "interface/CorrectedJet.h"
+
+namespace bsm
+{
+    // Arrays are reused between events: clear() keeps allocated memory
+    //
+    struct KinematicsArrays
+    {
+        void clear();
+        void push_back(const LorentzVector &);
+        void push_back(const CorrectedJet &);
+
+        uint32_t size() const
+        {
+            return pt.size();
+        }
+
+        CutValues pt;
+        CutValues eta;
+        CutValues phi;
+    };
+
+    // Distances between every row and column object. Matrix is stored row
+    // by row: matrix[row * columns.size() + column]. Loops run over
+    // contiguous arrays and are left for the compiler to vectorize
+    //
+    void deltaR(CutValues &matrix,
+                const KinematicsArrays &rows,
+                const KinematicsArrays &columns);
+
+    class EventKinematics
+    {
+        public:
+            typedef std::vector<const LorentzVector *> Leptons;
+            typedef std::vector<CorrectedJet> Jets;
+
+            enum JetCollection
+            {
+                NICE_JETS = 0,
+                GOOD_JETS,
+
+                JET_COLLECTIONS
+            };
+
+            EventKinematics();
+
+            void clear();
+
+            // MET is optional
+            //
+            void fill(const Leptons &,
+                      const Jets &nice_jets,
+                      const Jets &good_jets,
+                      const LorentzVector *met);
+
+            const KinematicsArrays &leptons() const;
+            const KinematicsArrays &jets(const JetCollection &) const;
+
+            bool hasMET() const;
+            float metPt() const;
+            float metPhi() const;
+
+            // Lepton-jet distances matrix with row per lepton
+            //
+            const CutValues &leptonJetDr(const JetCollection &) const;
+
+            float leptonJetDr(const JetCollection &,
+                              const uint32_t &jet,
+                              const uint32_t &lepton = 0) const;
+
+            // Index of the closest jet to the lepton or number of jets if
+            // there are no jets
+            //
+            uint32_t closestJet(const JetCollection &,
+                                const uint32_t &lepton = 0) const;
+
+            // |dphi| between MET and object
+            //
+            float leptonMetDphi(const uint32_t &lepton = 0) const;
+            float jetMetDphi(const JetCollection &,
+                             const uint32_t &jet) const;
+
+        private:
+            KinematicsArrays _leptons;
+            KinematicsArrays _jets[JET_COLLECTIONS];
+
+            bool _has_met;
+            float _met_pt;
+            float _met_phi;
+
+            mutable CutValues _dr[JET_COLLECTIONS];
+            mutable bool _is_dr_valid[JET_COLLECTIONS];
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+// Event List
+//
+// Stream list of selected events into a file. Entries are kept in a buffer
+// of limited size; full buffer is sorted and spilled into the object part
+// file as a sorted run. Merged objects hand their runs over and save()
+// merges all runs into the ordered list
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_EVENT_LIST
+#define BSM_EVENT_LIST
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "bsm_core/interface/Object.h"
+
+namespace bsm
+{
+    class EventList : public core::Object
+    {
+        public:
+            enum Format
+            {
+                TEXT = 0,   // run:lumi:event:value per line
+                BINARY      // packed entries
+            };
+
+            struct Entry
+            {
+                uint32_t run;
+                uint32_t lumi;
+                uint32_t event;
+                float value;
+            };
+
+            EventList();
+            EventList(const EventList &);
+
+            // List is disabled until the file is set. Part files are
+            // written next to the file: <file>.part<N>
+            //
+            void setFile(const std::string &);
+            void setFormat(const Format &);
+            void setBufferSize(const uint32_t &);
+
+            bool isEnabled() const;
+
+            void add(const uint32_t &run,
+                     const uint32_t &lumi,
+                     const uint32_t &event,
+                     const float &value);
+
+            // Merge all runs into the file ordered by run, lumi and event.
+            // Part files are removed on success and failure. Incomplete
+            // file is removed on failure
+            //
+            bool save();
+
+            // Object interface
+            //
+            virtual uint32_t id() const;
+            virtual ObjectPtr clone() const;
+            virtual void merge(const ObjectPtr &);
+            virtual void print(std::ostream &) const;
+
+        private:
+            // Prevent copying
+            //
+            EventList &operator =(const EventList &);
+
+            struct Run
+            {
+                std::string part;
+                uint64_t offset;
+                uint32_t size;
+            };
+
+            typedef std::vector<Entry> Entries;
+            typedef std::vector<Run> Runs;
+
+            void flush();
+            void removeParts();
+
+            std::string _file_name;
+            Format _format;
+            uint32_t _buffer_size;
+
+            Entries _entries;
+
+            std::string _part_name;
+            boost::shared_ptr<std::ofstream> _part;
+            uint64_t _part_size;
+
+            Runs _runs;
+            uint64_t _size;
+    };
+
+    bool operator <(const EventList::Entry &, const EventList::Entry &);
+}
+
+#endif
@@ -0,0 +1,117 @@
+// Generator decay index
+//
+// Event gen particles tree is flattened once per event into arrays. The tree
+// is walked breadth-first: children of every particle are stored next to
+// each other and always follow their parent. Decay modes of the W-bosons
+// and top quarks are resolved during the walk
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_GEN_DECAY
+#define BSM_GEN_DECAY
+
+#include <vector>
+
+#include <stdint.h>
+
+#include "bsm_input/interface/bsm_input_fwd.h"
+
+namespace bsm
+{
+    class GenDecay
+    {
+        public:
+            typedef std::vector<uint32_t> Indices;
+
+            enum Decay
+            {
+                UNKNOWN = 0,
+                ELECTRON,
+                MUON,
+                TAU,
+                HADRONIC
+            };
+
+            // Particle tags. Hard particles have status 3 and so do all
+            // their parents
+            //
+            enum Tag
+            {
+                HARD = 1,
+                FROM_TOP = 1 << 1,  // any top quark among parents
+                FROM_W = 1 << 2,    // any W-boson among parents
+                FROM_TAU = 1 << 3   // any tau among parents
+            };
+
+            enum
+            {
+                NONE = 0xFFFFFFFF
+            };
+
+            GenDecay();
+
+            // Arrays are reused between events
+            //
+            void fill(const Event *);
+
+            uint32_t size() const;
+
+            const GenParticle &particle(const uint32_t &) const;
+
+            int id(const uint32_t &) const;
+            int status(const uint32_t &) const;
+
+            // NONE for the event top level particles
+            //
+            uint32_t parent(const uint32_t &) const;
+            uint32_t level(const uint32_t &) const;
+
+            // Children are indices [firstChild, firstChild + children)
+            //
+            uint32_t firstChild(const uint32_t &) const;
+            uint32_t children(const uint32_t &) const;
+
+            uint32_t tags(const uint32_t &) const;
+            bool is(const uint32_t &, const Tag &) const;
+
+            // Decay of W-boson is defined by its status 3 children: charged
+            // lepton flavour, hadronic if there are no leptons or
+            // neutrinos. W with a neutrino but without charged lepton is
+            // UNKNOWN. Top quark decay is the decay of its W-boson. Other
+            // particles are UNKNOWN
+            //
+            Decay decay(const uint32_t &) const;
+
+            // First status 3 child with given |id| or NONE
+            //
+            uint32_t findChild(const uint32_t &particle,
+                               const int &abs_id) const;
+
+            // Top level status 3 particles
+            //
+            const Indices &hardParticles() const;
+
+        private:
+            void add(const GenParticle &,
+                     const uint32_t &parent,
+                     const uint32_t &level,
+                     const uint32_t &tags);
+
+            Decay wbosonDecay(const uint32_t &) const;
+
+            std::vector<const GenParticle *> _particles;
+            std::vector<int> _ids;
+            std::vector<int> _statuses;
+            Indices _parents;
+            Indices _levels;
+            Indices _first_children;
+            Indices _children;
+            std::vector<uint8_t> _tags;
+            std::vector<uint8_t> _decays;
+
+            Indices _hard_particles;
+    };
+}
+
+#endif
@@ -20,6 +20,8 @@
 #include "interface/AppController.h"
 #include "interface/Cut.h"
 #include "interface/DecayGenerator.h"
+#include "interface/GenDecay.h"
+#include "interface/OutputRegistry.h"
 #include "interface/SynchSelector.h"
 #include "interface/TemplateAnalyzer.h"
 #include "interface/bsm_fwd.h"
@@ -62,7 +64,7 @@ namespace bsm
                 HADRONIC = 4
             };
 
-            void fill(const GenParticle &);
+            void fill(const GenDecay &, const uint32_t &wboson);
             bool match(CorrectedJets &corrected_jets);
 
             Decay decay;
@@ -75,7 +77,7 @@ namespace bsm
 
         struct Top
         {
-            void fill(const GenParticle &);
+            void fill(const GenDecay &, const uint32_t &top);
             bool match(CorrectedJets &corrected_jets);
 
             Wboson wboson;
@@ -84,7 +86,7 @@ namespace bsm
 
         struct TTbar
         {
-            void fill(const Event *event);
+            void fill(const GenDecay &);
             bool match(CorrectedJets &corrected_jets);
 
             Top ltop;
@@ -93,7 +95,6 @@ namespace bsm
     }
 
     class GenMatchingAnalyzer: public Analyzer,
-                               public CounterDelegate,
                                public TemplatesDelegate
     {
         public:
@@ -119,6 +120,10 @@ namespace bsm
 
             const P4MonitorPtr ttbar() const;
 
+            // Histograms, cutflow and monitors written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
+
             JetEnergyCorrectionDelegate *getJetEnergyCorrectionDelegate() const;
             SynchSelectorDelegate *getSynchSelectorDelegate() const;
             TriggerDelegate *getTriggerDelegate() const;
@@ -129,10 +134,6 @@ namespace bsm
             virtual void setChi2Reconstruction(const Chi2Discriminators &ltop,
                                                const Chi2Discriminators &htop);
 
-            // Counter Delegate interface
-            //
-            virtual void didCounterAdd(const Counter *);
-
             // Anlayzer interface
             //
             virtual void onFileOpen(const std::string &filename, const Input *);
@@ -149,14 +150,16 @@ namespace bsm
             typedef boost::shared_ptr<H1Proxy> H1ProxyPtr;
             typedef ResonanceReconstructor::Mttbar Mttbar;
 
+            // Register output histograms: called by every constructor once
+            // histograms are booked or cloned
+            //
+            void registerOutputs();
+
             bool is_match(const gen::TTbar &gen, const Mttbar &reco);
 
             boost::shared_ptr<SynchSelector> _synch_selector;
 
-            // map: counter pointer to SynchSelector selection
-            //
-            std::map<const Counter *, uint32_t> _counters;
-            H1ProxyPtr _cutflow;
+            GenDecay _gen_decay;
 
             H1ProxyPtr _ltop_drsum;
             H1ProxyPtr _htop_drsum;
@@ -179,6 +182,8 @@ namespace bsm
             uint32_t _htop_match;
             uint32_t _reconstructions_match;
             uint32_t _p4_reconstructions_match;
+
+            OutputRegistry _outputs;
     };
 }
 
@@ -17,6 +17,7 @@
 #include "interface/Analyzer.h"
 #include "interface/DelegateManager.h"
 #include "interface/Monitor.h"
+#include "interface/OutputRegistry.h"
 #include "interface/TemplateAnalyzer.h"
 
 namespace bsm
@@ -120,6 +121,10 @@ namespace bsm
             const DeltaMonitorPtr ttbar_reco_delta() const;
             const DeltaMonitorPtr ttbar_gen_delta() const;
 
+            // Histograms and monitors written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
+
             JetEnergyCorrectionDelegate *getJetEnergyCorrectionDelegate() const;
             SynchSelectorDelegate *getSynchSelectorDelegate() const;
             PileupDelegate *getPileupDelegate() const;
@@ -144,6 +149,11 @@ namespace bsm
         private:
             typedef ResonanceReconstructor::Mttbar Mttbar;
 
+            // Register output histograms and monitors: called by every
+            // constructor once these are booked or cloned
+            //
+            void registerOutputs();
+
             Mttbar mttbar() const;
 
             boost::shared_ptr<SynchSelector> _synch_selector;
@@ -208,6 +218,8 @@ namespace bsm
             } _htop_njets;
 
             std::ostringstream _log;
+
+            OutputRegistry _outputs;
     };
 }
 
@@ -8,6 +8,9 @@
 #ifndef BSM_HISTOGRAM_BOOKKEEPER
 #define BSM_HISTOGRAM_BOOKKEEPER
 
+#include <string>
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 #include <boost/unordered_map.hpp>
 
@@ -21,6 +24,31 @@ namespace bsm
 {
 
 
+// Handles are indices into the bookkeeper arrays. Handle stays valid in
+// the bookkeeper copies: histograms are copied in the booking order
+//
+template<int Dimension>
+class HistogramHandle
+{
+public:
+
+    enum
+    {
+        INVALID = 0xFFFFFFFF
+    };
+
+    HistogramHandle(): index(INVALID) {}
+    explicit HistogramHandle(uint32_t const & value): index(value) {}
+
+    bool valid() const
+    {
+        return INVALID != index;
+    }
+
+    uint32_t index;
+};
+
+
 class HistogramBookkeeper : public core::Object
 {
 public:
@@ -29,39 +57,60 @@ public:
     typedef boost::shared_ptr<stat::H2> H2Ptr;
     typedef boost::shared_ptr<H1Proxy> H1ProxyPtr;
     typedef boost::shared_ptr<H2Proxy> H2ProxyPtr;
-    typedef boost::unordered_map<std::string, H1ProxyPtr> H1ProxyPtrContainer;
-    typedef boost::unordered_map<std::string, H2ProxyPtr> H2ProxyPtrContainer;
+    typedef std::vector<H1ProxyPtr> H1ProxyPtrContainer;
+    typedef std::vector<H2ProxyPtr> H2ProxyPtrContainer;
+    typedef std::vector<std::string> Keys;
+    typedef boost::unordered_map<std::string, uint32_t> Indices;
+    typedef HistogramHandle<1> H1Handle;
+    typedef HistogramHandle<2> H2Handle;
 
     HistogramBookkeeper() {};
     HistogramBookkeeper(HistogramBookkeeper const & object);
 
-    // Booking 1d histograms
-    void book1d(std::string const & key,
-                uint32_t const & bins, float const & min, float const & max
-               )
+    // Booking 1d histograms (booking the same key again resets histogram
+    // and returns the same handle)
+    H1Handle book1d(std::string const & key,
+                    uint32_t const & bins, float const & min, float const & max
+                   );
+
+    // Booking 2d histograms
+    H2Handle book2d(std::string const & key,
+                    uint32_t const & xbins, float const & xmin, float const & xmax,
+                    uint32_t const & ybins, float const & ymin, float const & ymax
+                   );
+
+    // Look up handles by key (throws if histogram is not booked)
+    H1Handle handle1d(std::string const & key) const
     {
-        _cache1d[key].reset(new H1Proxy(bins, min, max));
+        return H1Handle(_indices1d.at(key));
     }
 
-    // Booking 2d histograms
-    void book2d(std::string const & key,
-                uint32_t const & xbins, float const & xmin, float const & xmax,
-                uint32_t const & ybins, float const & ymin, float const & ymax
-               )
+    H2Handle handle2d(std::string const & key) const
+    {
+        return H2Handle(_indices2d.at(key));
+    }
+
+    // Access histograms by handle: use these in the events loop
+    stat::H1 & h1(H1Handle const & handle)
+    {
+        return *_histograms1d[handle.index];
+    }
+
+    stat::H2 & h2(H2Handle const & handle)
     {
-        _cache2d[key].reset(new H2Proxy(xbins, xmin, xmax, ybins, ymin, ymax));
+        return *_histograms2d[handle.index];
     }
 
-    // Get a pointer 1d histograms
+    // Get a pointer 1d histograms (hash look up on every call)
     const H1Ptr get1d(std::string const & key)
     {
-        return _cache1d.at(key)->histogram();
+        return _cache1d[_indices1d.at(key)]->histogram();
     }
 
-    // Get a pointer 1d histograms
+    // Get a pointer 2d histograms (hash look up on every call)
     const H2Ptr get2d(std::string const & key)
     {
-        return _cache2d.at(key)->histogram();
+        return _cache2d[_indices2d.at(key)]->histogram();
     }
 
     virtual void print(std::ostream &) const;
@@ -82,9 +131,26 @@ public:
 
 private:
 
+    // Prevent copying
+    HistogramBookkeeper & operator =(HistogramBookkeeper const &);
+
+    void add1d(std::string const & key, H1ProxyPtr const & proxy);
+    void add2d(std::string const & key, H2ProxyPtr const & proxy);
+
+    // Histograms are stored in the booking order
     H1ProxyPtrContainer _cache1d;
     H2ProxyPtrContainer _cache2d;
 
+    // Raw pointers to proxies histograms for the fast access
+    std::vector<stat::H1 *> _histograms1d;
+    std::vector<stat::H2 *> _histograms2d;
+
+    Keys _keys1d;
+    Keys _keys2d;
+
+    Indices _indices1d;
+    Indices _indices2d;
+
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include "bsm_input/interface/bsm_input_fwd.h"
 #include "interface/Analyzer.h"
+#include "interface/OutputRegistry.h"
 #include "interface/bsm_fwd.h"
 
 namespace bsm
@@ -31,6 +32,10 @@ namespace bsm
             const P4MonitorPtr selectedHltLeadingJetMonitor() const;
             const P4MonitorPtr recoLeadingJetMonitor() const;
 
+            // Monitors written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
+
             // Analyzer interface
             //
             virtual void onFileOpen(const std::string &filename, const Input *);
@@ -45,6 +50,11 @@ namespace bsm
             virtual void print(std::ostream &) const;
 
         private:
+            // Register output monitors: called by every constructor once
+            // monitors are booked or cloned
+            //
+            void registerOutputs();
+
             boost::shared_ptr<SynchSelector> _synch_selector;
             boost::shared_ptr<P4Selector> _hlt_jet_selector;
 
@@ -56,6 +66,7 @@ namespace bsm
             P4MonitorPtr _selected_hlt_leading_jet;
             P4MonitorPtr _reco_leading_jet;
 
+            OutputRegistry _outputs;
     };
 }
 
@@ -27,6 +27,9 @@ class JetCorrectionUncertainty;
 
 namespace bsm
 {
+    class JetCorrectionGrid;
+    class JetCorrectionGridBuilder;
+
     class JetEnergyCorrectionDelegate
     {
         public:
@@ -53,6 +56,11 @@ namespace bsm
                     const std::string &filename) {}
 
             virtual void setChildCorrection() {}
+
+            // Interpolate corrections on a precomputed grid. Validation
+            // also evaluates exact corrections and reports max deviation
+            //
+            virtual void setCorrectionGrid(const bool &validate) {}
     };
 
     class JetEnergyCorrectionOptions : public Options
@@ -76,6 +84,9 @@ namespace bsm
             
             void setChildCorrection();
 
+            void setCorrectionGrid(const bool &);
+            void setCorrectionGridValidation(const bool &);
+
             JetEnergyCorrectionDelegate *_delegate;
 
             DescriptionPtr _description;
@@ -91,27 +102,29 @@ namespace bsm
             typedef std::vector<const Muon *> Muons;
             typedef std::map<Level, std::string> CorrectionFiles;
 
-            // Output
-            //
-            typedef boost::shared_ptr<LorentzVector> LorentzVectorPtr;
-
             JetEnergyCorrections();
             JetEnergyCorrections(const JetEnergyCorrections &);
 
             const CorrectionFiles &correctionFiles() const;
             void setCorrectionFiles(const CorrectionFiles &);
 
-            // IMPORTANT: Invalid pointer will be returned if Jet Energy
-            //            Corrections are not loaded. As such, always check
-            //            returned value for validity, e.g.:
+            // Share loaded corrections and systematic with other object.
+            // Parsed parameters are immutable and are not copied: only the
+            // correctors are created per object
             //
-            //            LorentzVectorPtr corrected_p4 = jec->correctJet(...);
-            //            if (!corrected_p4)
+            void shareCorrections(const JetEnergyCorrections &);
+
+            // Correct jet into the (reused) corrected jet. False is returned
+            // if Jet Energy Corrections are not loaded or jet/event misses
+            // information needed for corrections, e.g.:
+            //
+            //            if (!jec->correctJet(corrected_jet, ...))
             //              cerr << failed to correct jet" << endl;
             //            else
             //              cout << "work with jet" << endl;
             //
-            CorrectedJet correctJet(const Jet *,
+            bool correctJet(CorrectedJet &,
+                    const Jet *,
                     const Event *,
                     const Electrons &,
                     const Muons &,
@@ -127,30 +140,71 @@ namespace bsm
             virtual void setSystematic(const Systematic &,
                     const std::string &filename);
 
+            virtual void setCorrectionGrid(const bool &validate);
+
             // Object interface
             //
+            virtual void merge(const ObjectPtr &);
             virtual void print(std::ostream &) const;
 
         private:
             typedef std::map<Level, JetCorrectorParameters> Corrections;
+            typedef boost::shared_ptr<const Corrections> CorrectionsPtr;
+            typedef boost::shared_ptr<const JetCorrectorParameters>
+                ParametersPtr;
+
             typedef boost::shared_ptr<FactorizedJetCorrector> CorrectorPtr;
             typedef boost::shared_ptr<JetCorrectionUncertainty> SystematicPtr;
+            typedef boost::shared_ptr<const JetCorrectionGrid> GridPtr;
+            typedef boost::shared_ptr<JetCorrectionGridBuilder>
+                GridBuilderPtr;
+
+            enum GridMode
+            {
+                NO_GRID = 0,
+                GRID,
+                VALIDATE_GRID
+            };
 
             CorrectorPtr corrector();
+            SystematicPtr systematic();
+
+            // Grid is built once from the shared parameters by the first
+            // jet of any copy. Levels that depend on NPV or jet energy are
+            // not tabulated and are always corrected exactly
+            //
+            GridPtr grid();
+            void resetGrid();
+
             void correct(CorrectedJet &, const Event *, const LorentzVector *met);
 
             virtual void cleanJet(CorrectedJet &,
                     const Electrons &,
                     const Muons &) = 0;
 
+            // Correctors keep state of the last jet and are created per
+            // object from the shared parameters
+            //
             CorrectorPtr _jec;
+            SystematicPtr _systematic;
 
-            Corrections _corrections;
+            CorrectionsPtr _corrections;
             CorrectionFiles _correction_files;
 
-            SystematicPtr _systematic;
+            ParametersPtr _systematic_parameters;
             std::string _systematic_file;
             int _systematic_direction;
+
+            GridMode _grid_mode;
+            GridBuilderPtr _grid_builder;
+            GridPtr _grid;
+
+            // Grid validation: max relative deviation of correction and
+            // max absolute deviation of uncertainty
+            //
+            uint64_t _validated_jets;
+            float _max_correction_deviation;
+            float _max_uncertainty_deviation;
     };
 
     class DeltaRJetEnergyCorrections: public JetEnergyCorrections
@@ -30,7 +30,6 @@ namespace bsm
     {
         public:
             typedef boost::shared_ptr<P4Monitor> P4MonitorPtr;
-            typedef boost::shared_ptr<LorentzVector> LorentzVectorPtr;
 
             JetEnergyCorrectionsAnalyzer();
             JetEnergyCorrectionsAnalyzer(const JetEnergyCorrectionsAnalyzer &);
@@ -14,6 +14,7 @@
 #include "interface/bsm_fwd.h"
 #include "interface/AppController.h"
 #include "interface/DelegateManager.h"
+#include "interface/LookupTable.h"
 
 namespace bsm
 {
@@ -80,6 +81,10 @@ namespace bsm
             virtual float scale(const float &reco_eta);
 
             Systematic _systematic;
+
+            // Scale factors binned in jet eta
+            //
+            LookupTable _scales;
     };
 }
 
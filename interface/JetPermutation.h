@@ -1,5 +1,9 @@
 // Construct different jet permutations for the BSM ttbar-like analysis.
 //
+// Jets subsets are bitmasks. Tables of all leptonic/hadronic subsets pairs
+// are built once for every jets multiplicity up to the limit and shared by
+// all permutations.
+//
 // Created by Samvel Khalatyan, Aug 11, 2011
 // Copyright 2011, All rights reserved
 
@@ -9,85 +13,115 @@
 #include <stdint.h>
 
 #include <vector>
-#include <map>
-
-#include <boost/shared_ptr.hpp>
 
 #include "bsm_input/interface/bsm_input_fwd.h"
-#include "bsm_stat/interface/bsm_stat_fwd.h"
 
 namespace bsm
 {
-    class JetPermutation
+    // Immutable table of jets subsets pairs. The table is built before
+    // main() is called and may be used by any number of threads
+    //
+    class JetPermutationTable
     {
         public:
-            typedef std::vector<const Jet *> Jets;
-
-            JetPermutation();
+            enum
+            {
+                MAX_JETS = 10
+            };
 
-            // Initialize with array of jets
-            //
-            void init(const Jets &jets);
+            typedef uint32_t Mask;
 
-            // get permutted jets
+            // Unordered pair of non-empty disjoint subsets
             //
-            bool next();
+            struct Combination
+            {
+                Mask left;
+                Mask right;
+            };
 
-            Jets leptonicJets();
-            Jets hadronicJets();
+            typedef std::vector<Combination> Combinations;
 
-        private:
-            struct Combination
+            // Jets indices of the subset in increasing order
+            //
+            struct Indices
             {
-                Combination(): left(1), right(1)
+                Indices():
+                    begin(0),
+                    end(0)
                 {
                 }
 
-                bool operator ==(const Combination &object)
+                Indices(const uint8_t *begin_, const uint8_t *end_):
+                    begin(begin_),
+                    end(end_)
                 {
-                    return (object.left == left
-                            && object.right == right)
+                }
 
-                        || (object.left == right
-                            && object.right == left);
+                uint32_t size() const
+                {
+                    return end - begin;
                 }
 
-                uint64_t left;  // leptonic
-                uint64_t right; // hadronic
+                const uint8_t *begin;
+                const uint8_t *end;
             };
 
-            // map<PrimeNumber, vector ID>
-            //
-            typedef std::map<uint32_t, uint32_t> PrimeIDs;
+            static const JetPermutationTable &instance();
 
-            // collection of all permutations: prime number products
+            // Combinations are ordered by the highest used jet: all
+            // combinations of n jets are the first combinations(n) entries
             //
-            typedef std::vector<Combination> Permutations;
+            uint32_t combinations(const uint32_t &jets) const;
+            const Combination *begin() const;
 
-            // all possible permutations for different multiplicities
-            //
-            typedef std::map<uint32_t, Permutations> PermutationTables;
+            Indices indices(const Mask &) const;
 
+        private:
+            JetPermutationTable();
 
+            Combinations _combinations;
+            std::vector<uint32_t> _sizes;
 
-            // Convert product of prime numbers to jets
-            //
-            Jets jets(uint64_t product);
+            std::vector<uint32_t> _offsets;
+            std::vector<uint8_t> _indices;
+
+            static const JetPermutationTable _instance;
+    };
+
+    class JetPermutation
+    {
+        public:
+            typedef std::vector<const Jet *> Jets;
+            typedef JetPermutationTable::Mask Mask;
+            typedef JetPermutationTable::Indices Indices;
+
+            JetPermutation();
 
-            void generatePermutations(const uint32_t &size);
-            void expandPrimeIDs(const uint32_t &size);
+            // Initialize with array of jets. At most
+            // JetPermutationTable::MAX_JETS (10) jets are supported:
+            // std::out_of_range is thrown for more jets. Select leading jets
+            // before the call
+            //
+            void init(const Jets &jets);
 
+            // get permutted jets
+            //
+            bool next();
 
+            // Jets of the current permutation as bitmasks or indices in the
+            // jets array. Nothing is allocated
+            //
+            Mask leptonicMask() const;
+            Mask hadronicMask() const;
 
-            boost::shared_ptr<stat::PrimeNumber> _prime_generator;
-            
-            const Jets *_jets;
+            Indices leptonic() const;
+            Indices hadronic() const;
 
-            PrimeIDs _prime_id;
-            PermutationTables _permutation_tables;
+        private:
+            typedef JetPermutationTable::Combination Combination;
 
-            Permutations::const_iterator _current_permutation;
-            Permutations::const_iterator _end_permutation;
+            const Combination *_current_permutation;
+            const Combination *_end_permutation;
             bool _flip_combination;
     };
 }
@@ -0,0 +1,194 @@
+// Flat binned lookup table for weights and scale factors
+//
+// N-dimensional table kept in one contiguous array. Nominal, up and down
+// values of each bin are stored side by side so that a systematic variation
+// is read from the same cache line as the nominal value.
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_LOOKUP_TABLE
+#define BSM_LOOKUP_TABLE
+
+#include <algorithm>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+class TH1;
+
+namespace bsm
+{
+    // Table axis: either uniform bins or arbitrary edges. Values outside
+    // of the axis range are clamped to the first or last bin, NaN is put
+    // into the first bin
+    //
+    class LookupAxis
+    {
+        public:
+            // Edge defines to which bin a value sitting on the bin edge
+            // belongs: [low, high) or (low, high]
+            //
+            enum Edge
+            {
+                LOWER_INCLUSIVE = 0,
+                UPPER_INCLUSIVE
+            };
+
+            LookupAxis();
+
+            // Uniform axis
+            //
+            LookupAxis(const uint32_t &bins, const float &min, const float &max);
+
+            // Variable bins axis: edges.size() - 1 bins
+            //
+            LookupAxis(const std::vector<float> &edges,
+                    const Edge & = LOWER_INCLUSIVE);
+
+            uint32_t bins() const
+            {
+                return _bins;
+            }
+
+            uint32_t find(const float &value) const
+            {
+                // NaN fails every comparison
+                //
+                if (value != value)
+                    return 0;
+
+                if (_edges.empty())
+                {
+                    // Clamp before the conversion: out of range float to
+                    // int conversion is undefined
+                    //
+                    if (value <= _min)
+                        return 0;
+
+                    if (value >= _max)
+                        return _last_bin;
+
+                    return std::min(static_cast<int>((value - _min) * _scale),
+                                    _last_bin);
+                }
+
+                // Only inner edges are searched: the result is automatically
+                // clamped to [0, bins - 1]
+                //
+                return UPPER_INCLUSIVE == _edge
+                    ? std::lower_bound(_edges.begin(), _edges.end(), value)
+                        - _edges.begin()
+                    : std::upper_bound(_edges.begin(), _edges.end(), value)
+                        - _edges.begin();
+            }
+
+        private:
+            uint32_t _bins;
+            int _last_bin;
+
+            float _min;
+            float _max;
+            float _scale;
+
+            std::vector<float> _edges;
+            Edge _edge;
+    };
+
+    class LookupTable
+    {
+        public:
+            enum Plane
+            {
+                NOMINAL = 0,
+                UP,
+                DOWN,
+
+                PLANES
+            };
+
+            typedef std::vector<LookupAxis> Axes;
+
+            LookupTable();
+            LookupTable(const LookupAxis &);
+            LookupTable(const LookupAxis &, const LookupAxis &);
+            LookupTable(const LookupAxis &, const LookupAxis &,
+                    const LookupAxis &);
+
+            uint32_t dimension() const
+            {
+                return _axes.size();
+            }
+
+            const LookupAxis &axis(const uint32_t &dimension) const
+            {
+                return _axes[dimension];
+            }
+
+            // Total number of bins in one plane
+            //
+            uint32_t bins() const;
+
+            bool empty() const
+            {
+                return _values.empty();
+            }
+
+            // Check if plane values were set
+            //
+            bool has(const Plane &plane) const
+            {
+                return _planes & (1 << plane);
+            }
+
+            float value(const float &x, const Plane &plane = NOMINAL) const
+            {
+                return _values[_axes[0].find(x) * PLANES + plane];
+            }
+
+            float value(const float &x, const float &y,
+                    const Plane &plane = NOMINAL) const
+            {
+                return _values[(_axes[0].find(x) * _strides[0]
+                        + _axes[1].find(y)) * PLANES + plane];
+            }
+
+            float value(const float &x, const float &y, const float &z,
+                    const Plane &plane = NOMINAL) const
+            {
+                return _values[(_axes[0].find(x) * _strides[0]
+                        + _axes[1].find(y) * _strides[1]
+                        + _axes[2].find(z)) * PLANES + plane];
+            }
+
+            // Fill plane with values given in the row-major order: the last
+            // axis changes fastest
+            //
+            void set(const Plane &, const std::vector<float> &values);
+
+            // Load plane from histogram contents. Histogram should have at
+            // least as many bins as the table; reading starts at first_bin
+            // of each axis
+            //
+            bool load(const Plane &, const TH1 *, const int &first_bin = 1);
+
+            // Load plane from text: whitespace separated values in row-major
+            // order, lines starting with # are ignored
+            //
+            bool load(const Plane &, std::istream &);
+            bool load(const Plane &, const std::string &filename);
+
+        private:
+            void init();
+
+            Axes _axes;
+            std::vector<uint32_t> _strides;
+
+            std::vector<float> _values;
+            uint32_t _planes;
+    };
+}
+
+#endif
@@ -1,7 +1,9 @@
 // A collection of Monitors
 //
 // Monitors are used to easily check different quantities, physics objects,
-// jets, etc.
+// jets, etc. Streaming summaries (moments and quantiles) of the monitored
+// quantities are kept once enableSummaries() is called. Summaries are
+// printed next to histograms and named after the written histograms
 //
 // Created by Samvel Khalatyan, Apr 22, 2011
 // Copyright 2011, All rights reserved
@@ -40,6 +42,9 @@ namespace bsm
                         const LorentzVector &,
                         const float &weight = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr r() const;
             const H1Ptr eta() const;
             const H1Ptr phi() const;
@@ -79,6 +84,9 @@ namespace bsm
 
             void fill(const Electrons &, const float &weigth = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr multiplicity() const;
             const H1Ptr pt() const;
             const H1Ptr leading_pt() const;
@@ -112,6 +120,9 @@ namespace bsm
             
             void fill(const Jets &, const float &weight = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr multiplicity() const;
             const H1Ptr pt() const;
             const H1Ptr uncorrected_pt() const;
@@ -149,6 +160,9 @@ namespace bsm
 
             void fill(const LorentzVector &, const float &weight = 1);
 
+            void enableSummaries();
+            virtual NamedSummaries summaries() const;
+
             const H1Ptr energy() const;
             const H1Ptr px() const;
             const H1Ptr py() const;
@@ -198,6 +212,9 @@ namespace bsm
             
             void fill(const GenParticle &, const float &weight = 1);
 
+            void enableSummaries();
+            virtual NamedSummaries summaries() const;
+
             const H1Ptr pdg_id() const;
             const H1Ptr status() const;
 
@@ -222,6 +239,9 @@ namespace bsm
             
             void fill(const MissingEnergy &, const float &weight = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr pt() const;
             const H1Ptr x() const;
             const H1Ptr y() const;
@@ -257,6 +277,9 @@ namespace bsm
             
             void fill(const Muons &, const float &weight = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr multiplicity() const;
             const H1Ptr pt() const;
             const H1Ptr leading_pt() const;
@@ -291,6 +314,9 @@ namespace bsm
             
             void fill(const PrimaryVertices &, const float &weight = 1);
 
+            void enableSummaries();
+            NamedSummaries summaries() const;
+
             const H1Ptr multiplicity() const;
             const H1Ptr x() const;
             const H1Ptr y() const;
@@ -11,11 +11,45 @@
 #include <boost/shared_ptr.hpp>
 
 #include "interface/Analyzer.h"
+#include "interface/AppController.h"
 #include "interface/bsm_fwd.h"
 
 namespace bsm
 {
-    class MonitorAnalyzer : public Analyzer
+    class MonitorDelegate
+    {
+        public:
+            virtual ~MonitorDelegate()
+            {
+            }
+
+            virtual void setSummaries()
+            {
+            }
+    };
+
+    class MonitorOptions : public Options
+    {
+        public:
+            MonitorOptions();
+
+            void setDelegate(MonitorDelegate *);
+            MonitorDelegate *delegate() const;
+
+            // Options interface
+            //
+            virtual DescriptionPtr description() const;
+
+        private:
+            void setSummaries();
+
+            MonitorDelegate *_delegate;
+
+            DescriptionPtr _description;
+    };
+
+    class MonitorAnalyzer : public Analyzer,
+        public MonitorDelegate
     {
         public:
             typedef boost::shared_ptr<ElectronsMonitor> ElMonitorPtr;
@@ -37,6 +71,10 @@ namespace bsm
             const METMonitorPtr missingEnergy() const;
             const PVMonitorPtr primaryVertices() const;
 
+            // Monitor Delegate interface
+            //
+            virtual void setSummaries();
+
             // Analyzer interface
             //
             virtual void onFileOpen(const std::string &filename, const Input *);
@@ -54,6 +54,11 @@ namespace bsm
             bool pushd(TDirectory *parent = 0);
             bool popd();
 
+            // Summaries are written in the current directory as
+            // <name>_summary
+            //
+            void writeSummaries(const NamedSummaries &);
+
             std::string folder();
 
             TCanvasPtr canvas();
@@ -14,6 +14,7 @@
 #include "bsm_input/interface/bsm_input_fwd.h"
 #include "bsm_input/interface/GenParticle.pb.h"
 #include "interface/Analyzer.h"
+#include "interface/OutputRegistry.h"
 #include "interface/bsm_fwd.h"
 
 namespace bsm
@@ -80,6 +81,10 @@ namespace bsm
             const P4MonitorPtr htopMonitor() const;
             const DeltaMonitorPtr topDeltaMonitor() const;
 
+            // Histograms written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
+
             // Mttbar Delegate interface
             // 
             virtual void setUseGeneratorMass(const bool &);
@@ -111,6 +116,11 @@ namespace bsm
                 WBOSON = 24
             };
 
+            // Register output histograms: called by every constructor once
+            // histograms are booked or cloned
+            //
+            void registerOutputs();
+
             float getMttbarGen(const Event *);
 
             GenParticles::const_iterator find(const GenParticles &,
@@ -143,6 +153,8 @@ namespace bsm
             bool _use_generator_mass;
 
             boost::shared_ptr<Counter> _gen_events;
+
+            OutputRegistry _outputs;
     };
 }
 
@@ -0,0 +1,153 @@
+// Output Registry
+//
+// Analyzers register histograms, cutflows and monitors with names, axis
+// titles and output directories at booking. AppController writes all
+// registered products into the output file in one pass at the end of the
+// job
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_OUTPUT_REGISTRY
+#define BSM_OUTPUT_REGISTRY
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "interface/bsm_fwd.h"
+
+class TDirectory;
+
+namespace bsm
+{
+    class OutputRegistry
+    {
+        public:
+            typedef boost::shared_ptr<H1Proxy> H1ProxyPtr;
+            typedef boost::shared_ptr<H2Proxy> H2ProxyPtr;
+            typedef boost::shared_ptr<BootstrapH1> BootstrapH1Ptr;
+            typedef boost::shared_ptr<MultiplicityCutflow> CutflowPtr;
+            typedef boost::shared_ptr<P4Monitor> P4MonitorPtr;
+            typedef boost::shared_ptr<GenParticleMonitor> GenParticleMonitorPtr;
+            typedef boost::shared_ptr<DeltaMonitor> DeltaMonitorPtr;
+
+            // Cutflow bins hold either number of events or sum of event
+            // weights that pass each cut
+            //
+            enum CutflowContent
+            {
+                CUTFLOW_EVENTS = 0,
+                CUTFLOW_WEIGHTS
+            };
+
+            // Empty directory stands for the output file top level
+            //
+            void add(const std::string &name,
+                     const H1ProxyPtr &,
+                     const std::string &x_title = "",
+                     const std::string &directory = "");
+
+            void add(const std::string &name,
+                     const H2ProxyPtr &,
+                     const std::string &x_title = "",
+                     const std::string &y_title = "",
+                     const std::string &directory = "");
+
+            // Bootstrap replicas are written as 2D histogram: the replica
+            // number is stored along Y
+            //
+            void add(const std::string &name,
+                     const BootstrapH1Ptr &,
+                     const std::string &x_title = "",
+                     const std::string &directory = "");
+
+            // Cutflow is written as 1D histogram with one bin per cut. Bins
+            // are read from the cut counters at write
+            //
+            void add(const std::string &name,
+                     const CutflowPtr &,
+                     const CutflowContent &,
+                     const std::string &x_title = "",
+                     const std::string &directory = "");
+
+            // Monitors are written with the matching canvas into a folder
+            // named after the title: spaces are replaced with underscores
+            //
+            void add(const std::string &title,
+                     const P4MonitorPtr &,
+                     const std::string &axis_subtitle = "",
+                     const std::string &directory = "");
+
+            void add(const std::string &title,
+                     const GenParticleMonitorPtr &,
+                     const std::string &axis_subtitle = "",
+                     const std::string &directory = "");
+
+            void add(const std::string &title,
+                     const DeltaMonitorPtr &,
+                     const std::string &axis_subtitle = "",
+                     const std::string &directory = "");
+
+            bool empty() const;
+            uint32_t size() const;
+
+            // Keep streaming summaries of all registered 1D histograms and
+            // monitors. Summaries are written next to histograms as
+            // <name>_summary
+            //
+            void enableSummaries();
+
+            // Products are converted and written directory by directory.
+            // Histograms are read from proxies only here: these should be
+            // merged by the time of the call
+            //
+            void write(TDirectory *) const;
+
+            // Write products into a new file and atomically replace the
+            // target with it: readers never see a partially written file
+            //
+            bool save(const std::string &file_name) const;
+
+        private:
+            void write(const std::string &name,
+                       const std::string &x_title,
+                       const BootstrapH1 &) const;
+
+            void write(const std::string &name,
+                       const std::string &x_title,
+                       const MultiplicityCutflow &,
+                       const CutflowContent &) const;
+
+            // Monitors keep the title in the name and the axis subtitle in
+            // the X title
+            //
+            struct Product
+            {
+                Product();
+
+                std::string name;
+                std::string directory;
+                std::string x_title;
+                std::string y_title;
+
+                H1ProxyPtr h1;
+                H2ProxyPtr h2;
+                BootstrapH1Ptr bootstrap;
+
+                CutflowPtr cutflow;
+                CutflowContent cutflow_content;
+
+                P4MonitorPtr p4;
+                GenParticleMonitorPtr gen_particle;
+                DeltaMonitorPtr delta;
+            };
+
+            typedef std::vector<Product> Products;
+
+            Products _products;
+    };
+}
+
+#endif
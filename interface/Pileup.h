@@ -12,6 +12,7 @@
 #include "bsm_core/interface/Object.h"
 #include "bsm_input/interface/bsm_input_fwd.h"
 #include "interface/AppController.h"
+#include "interface/LookupTable.h"
 
 namespace bsm
 {
@@ -72,11 +73,11 @@ namespace bsm
             virtual void print(std::ostream &) const;
 
         private:
-            typedef std::vector<float> Weight1D;
-            typedef std::vector<Weight1D> Weight2D;
-            typedef std::vector<Weight2D> Weight3D;
-
-            Weight3D _weight;
+            // Weights are indexed with number of interactions in the
+            // previous, current and next bunch crossings
+            //
+            LookupTable _weights;
+            LookupTable::Plane _plane;
     };
 }
 
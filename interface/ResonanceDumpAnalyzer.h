@@ -16,6 +16,7 @@
 
 #include "interface/Analyzer.h"
 #include "interface/EventDump.h"
+#include "interface/GenDecay.h"
 #include "interface/HadronicTopAnalyzer.h"
 #include "interface/Monitor.h"
 #include "interface/TemplateAnalyzer.h"
@@ -87,6 +88,8 @@ namespace bsm
             boost::shared_ptr<SynchSelector> _synch_selector;
             boost::shared_ptr<ResonanceReconstructor> _reconstructor;
 
+            GenDecay _gen_decay;
+
             struct {
                 uint32_t min;
                 uint32_t max;
@@ -19,6 +19,50 @@
 
 namespace bsm
 {
+    // Structure-of-arrays view of the objects: each selector quantity is
+    // kept in a separate array. Arrays may hold objects of one or several
+    // events and are reused: clear() keeps the allocated memory
+    //
+    struct P4Arrays
+    {
+        void clear();
+        void push_back(const LorentzVector &);
+        void push_back(const CorrectedJet &);
+
+        uint32_t size() const
+        {
+            return pt.size();
+        }
+
+        CutValues pt;
+        CutValues abs_eta;
+    };
+
+    struct ElectronArrays : public P4Arrays
+    {
+        void clear();
+        void push_back(const Electron &, const PrimaryVertex &);
+
+        CutValues abs_dz;   // |el.z() - pv.z()|
+    };
+
+    struct MuonArrays : public P4Arrays
+    {
+        void clear();
+        void push_back(const Muon &, const PrimaryVertex &);
+
+        SelectionMask has_extra;
+        CutValues is_global;
+        CutValues is_tracker;
+        CutValues segments;
+        CutValues muon_hits;
+        CutValues normalized_chi2;
+        CutValues tracker_hits;
+        CutValues pixel_hits;
+        CutValues abs_d0;
+        CutValues abs_dz;   // |mu.z() - pv.z()|
+    };
+
     // Selector Interface. Each selector can be enabled or disabled
     //
     class Selector : public core::Object
@@ -76,6 +120,12 @@ namespace bsm
             //
             bool apply(const Electron &, const PrimaryVertex &);
 
+            // Apply selector to all electrons with mask set. Mask size
+            // should match the number of electrons. Return number of
+            // selected electrons
+            //
+            uint32_t apply(const ElectronArrays &, SelectionMask &);
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -100,6 +150,11 @@ namespace bsm
             //
             virtual bool apply(const Jet &);
 
+            // Apply selector to all objects with mask set. Mask size should
+            // match the number of objects. Return number of selected objects
+            //
+            uint32_t apply(const P4Arrays &, SelectionMask &);
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -140,10 +195,19 @@ namespace bsm
             //
             CutPtr cut(const uint32_t &) const;
 
+            // Number of cuts: one per multiplicity below max and the last
+            // one for max and above
+            //
+            uint32_t size() const;
+
             // Apply cutflow to a number
             //
             virtual bool apply(const uint32_t &);
 
+            // Weight used in the following applies, e.g. event weight
+            //
+            void setWeight(const double &);
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -177,6 +241,11 @@ namespace bsm
             //
             virtual bool apply(const Muon &, const PrimaryVertex &);
 
+            // Apply selector to all muons with mask set. Mask size should
+            // match the number of muons. Return number of selected muons
+            //
+            uint32_t apply(const MuonArrays &, SelectionMask &);
+
             // Object interface
             //
             virtual uint32_t id() const;
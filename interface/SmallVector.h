@@ -0,0 +1,169 @@
+// Vector with inline storage for the first N elements
+//
+// Containers on the reconstruction path are tiny (two neutrino solutions,
+// a few jets per leg) and are refilled for every hypothesis. SmallVector
+// keeps up to N elements inside the object and falls back to the heap only
+// if more are added. Elements are assigned, not constructed: clear() does
+// not release elements and T should be default constructible
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_SMALL_VECTOR
+#define BSM_SMALL_VECTOR
+
+#include <stdint.h>
+
+namespace bsm
+{
+    template<typename T, uint32_t N>
+    class SmallVector
+    {
+        public:
+            typedef T value_type;
+            typedef T *iterator;
+            typedef const T *const_iterator;
+
+            SmallVector():
+                _data(_items),
+                _size(0),
+                _capacity(N)
+            {
+            }
+
+            SmallVector(const SmallVector &object):
+                _data(_items),
+                _size(0),
+                _capacity(N)
+            {
+                assign(object.begin(), object.end());
+            }
+
+            ~SmallVector()
+            {
+                if (_items != _data)
+                    delete[] _data;
+            }
+
+            SmallVector &operator=(const SmallVector &object)
+            {
+                if (this != &object)
+                    assign(object.begin(), object.end());
+
+                return *this;
+            }
+
+            template<typename Iterator>
+                void assign(Iterator begin, const Iterator &end)
+            {
+                clear();
+
+                for(; end != begin; ++begin)
+                    push_back(*begin);
+            }
+
+            void push_back(const T &value)
+            {
+                if (_capacity == _size)
+                {
+                    // Value may be an element of this vector: copy it
+                    // before the storage is released
+                    //
+                    const T copy(value);
+
+                    reserve(2 * _capacity);
+
+                    _data[_size++] = copy;
+
+                    return;
+                }
+
+                _data[_size++] = value;
+            }
+
+            void reserve(const uint32_t &capacity)
+            {
+                if (_capacity >= capacity)
+                    return;
+
+                T *data = new T[capacity];
+                for(uint32_t i = 0; _size > i; ++i)
+                    data[i] = _data[i];
+
+                if (_items != _data)
+                    delete[] _data;
+
+                _data = data;
+                _capacity = capacity;
+            }
+
+            void clear()
+            {
+                _size = 0;
+            }
+
+            bool empty() const
+            {
+                return !_size;
+            }
+
+            uint32_t size() const
+            {
+                return _size;
+            }
+
+            uint32_t capacity() const
+            {
+                return _capacity;
+            }
+
+            iterator begin()
+            {
+                return _data;
+            }
+
+            iterator end()
+            {
+                return _data + _size;
+            }
+
+            const_iterator begin() const
+            {
+                return _data;
+            }
+
+            const_iterator end() const
+            {
+                return _data + _size;
+            }
+
+            T &operator[](const uint32_t &i)
+            {
+                return _data[i];
+            }
+
+            const T &operator[](const uint32_t &i) const
+            {
+                return _data[i];
+            }
+
+            T &back()
+            {
+                return _data[_size - 1];
+            }
+
+            const T &back() const
+            {
+                return _data[_size - 1];
+            }
+
+        private:
+            T _items[N];
+
+            T *_data;
+            uint32_t _size;
+            uint32_t _capacity;
+    };
+}
+
+#endif
@@ -1,5 +1,8 @@
 // Proxy to Stat objects to make them clonable
 //
+// Fills go directly into the histogram. Histogram may be allocated on the
+// first fill: clones of rarely filled histograms stay empty
+//
 // Created by Samvel Khalatyan, Jun 01, 2011
 // Copyright 2011, All rights reserved
 
@@ -10,19 +13,45 @@
 
 #include "bsm_core/interface/Object.h"
 #include "bsm_stat/interface/bsm_stat_fwd.h"
+#include "interface/StreamSummary.h"
 
 namespace bsm
 {
+    // Histogram is either allocated when proxy is booked or on the first
+    // fill (access). Use the latter for large or mostly unfilled histograms:
+    // per-thread clones do not carry copies of empty histograms
+    //
+    enum Allocation
+    {
+        ALLOCATE_ON_BOOKING = 0,
+        ALLOCATE_ON_FILL
+    };
+
     class H1Proxy : public core::Object
     {
         public:
             typedef boost::shared_ptr<stat::H1> H1Ptr;
 
-            H1Proxy(const uint32_t &bins, const float &min, const float &max);
+            H1Proxy(const uint32_t &bins,
+                    const float &min,
+                    const float &max,
+                    const Allocation &allocation = ALLOCATE_ON_BOOKING);
+
             H1Proxy(const H1Proxy &);
 
+            // Empty histogram is allocated if there were no fills
+            //
             const H1Ptr histogram() const;
 
+            // Keep moments and quantiles of the filled values next to the
+            // histogram. These do not depend on binning and include
+            // under- and overflows. Summary is null unless enabled
+            //
+            void enableSummary();
+            const StreamSummaryPtr summary() const;
+
+            void fill(const double &x, const double &weight = 1);
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -37,7 +66,15 @@ namespace bsm
             //
             H1Proxy &operator =(const H1Proxy &);
 
-            H1Ptr _histogram;
+            void allocate() const;
+
+            uint32_t _bins;
+            float _min;
+            float _max;
+            Allocation _allocation;
+
+            mutable H1Ptr _histogram;
+            StreamSummaryPtr _summary;
     };
 
     class H2Proxy : public core::Object
@@ -48,15 +85,23 @@ namespace bsm
             H2Proxy(const uint32_t &x_bins,
                     const float &x_min,
                     const float &x_max,
-                    
+
                     const uint32_t &y_bins,
                     const float &y_min,
-                    const float &y_max);
+                    const float &y_max,
+
+                    const Allocation &allocation = ALLOCATE_ON_BOOKING);
 
             H2Proxy(const H2Proxy &);
 
+            // Empty histogram is allocated if there were no fills
+            //
             const H2Ptr histogram() const;
 
+            void fill(const double &x,
+                      const double &y,
+                      const double &weight = 1);
+
             // Object interface
             //
             virtual uint32_t id() const;
@@ -71,7 +116,19 @@ namespace bsm
             //
             H2Proxy &operator =(const H2Proxy &);
 
-            H2Ptr _histogram;
+            void allocate() const;
+
+            uint32_t _x_bins;
+            float _x_min;
+            float _x_max;
+
+            uint32_t _y_bins;
+            float _y_min;
+            float _y_max;
+
+            Allocation _allocation;
+
+            mutable H2Ptr _histogram;
     };
 }
 
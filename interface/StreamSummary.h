@@ -0,0 +1,144 @@
+// Streaming summaries of filled values
+//
+// Moments and quantiles of values are kept independently of the histogram
+// binning. Both use fixed memory and are mergeable: per-thread clones are
+// combined with the same merge() as histograms. Values are accepted with any
+// weight sign: summaries describe the same sample as the histograms
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_STREAM_SUMMARY
+#define BSM_STREAM_SUMMARY
+
+#include <iosfwd>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "bsm_core/interface/Object.h"
+#include "bsm_stat/interface/bsm_stat_fwd.h"
+
+namespace bsm
+{
+    // Weighted sums of values shifted by the first value: the shift keeps
+    // variance precise and the sums accept negative weights exactly like
+    // the histograms do
+    //
+    class Moments
+    {
+        public:
+            Moments();
+
+            void fill(const double &x, const double &weight = 1);
+            void merge(const Moments &);
+
+            uint64_t entries() const;
+            double weight() const;
+
+            double mean() const;
+            double variance() const;
+            double rms() const;
+
+            double min() const;
+            double max() const;
+
+        private:
+            uint64_t _entries;
+            double _shift;
+            double _weight;
+            double _sum;
+            double _sum2;
+
+            double _min;
+            double _max;
+    };
+
+    // Merging t-digest: values are buffered and periodically compressed
+    // into sorted centroids. Centroids near the tails are kept small,
+    // number of centroids is bounded by a few times the compression
+    //
+    class QuantileSketch
+    {
+        public:
+            QuantileSketch(const uint32_t &compression = 100);
+
+            // Sketch holds positive weights only: values with non-positive
+            // weights are skipped
+            //
+            void fill(const double &x, const double &weight = 1);
+            void merge(const QuantileSketch &);
+
+            double weight() const;
+
+            // q is in [0, 1]. Zero is returned for empty sketch
+            //
+            double quantile(const double &q) const;
+
+            // Weight of values below x: inverse of the quantile
+            //
+            double rank(const double &x) const;
+
+            uint32_t centroids() const;
+
+        private:
+            struct Centroid
+            {
+                double mean;
+                double weight;
+            };
+
+            typedef std::vector<Centroid> Centroids;
+
+            static bool isLess(const Centroid &, const Centroid &);
+
+            void compress() const;
+
+            uint32_t _compression;
+
+            mutable Centroids _centroids;
+            mutable Centroids _buffer;
+
+            double _weight;
+            double _min;
+            double _max;
+    };
+
+    class StreamSummary : public core::Object
+    {
+        public:
+            StreamSummary(const uint32_t &compression = 100);
+
+            void fill(const double &x, const double &weight = 1);
+
+            const Moments &moments() const;
+
+            // Negative weights are sketched separately and subtracted from
+            // the positive ones
+            //
+            double quantile(const double &q) const;
+
+            // Object interface
+            //
+            virtual uint32_t id() const;
+
+            virtual ObjectPtr clone() const;
+            virtual void merge(const ObjectPtr &);
+
+            virtual void print(std::ostream &) const;
+
+        private:
+            Moments _moments;
+            QuantileSketch _quantiles;
+            QuantileSketch _negative_quantiles;
+    };
+
+    typedef boost::shared_ptr<StreamSummary> StreamSummaryPtr;
+
+    // Summary is converted into histogram with labeled bins: entries,
+    // weight, mean, rms, min, max and quantiles
+    //
+    stat::TH1Ptr convert(const StreamSummary &);
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include "interface/CorrectedJet.h"
 #include "interface/TriggerAnalyzer.h"
 #include "interface/Cache.h"
+#include "interface/EventKinematics.h"
 
 namespace bsm
 {
@@ -65,6 +66,11 @@ namespace bsm
             virtual void setInvertChi2(const bool &) {}
 
             virtual void setWflavor(const Wflavor &) {}
+
+            // Assign events to lepton channel and W flavor categories in
+            // one pass instead of selecting one lepton mode and W flavor
+            //
+            virtual void setCategories(const bool &) {}
     };
 
     class SynchSelectorOptions:
@@ -102,7 +108,6 @@ namespace bsm
     {
         public:
             typedef boost::shared_ptr<Cut> CutPtr;
-            typedef boost::shared_ptr<LorentzVector> LorentzVectorPtr;
 
             typedef boost::shared_ptr<MultiplicityCutflow> CutflowPtr;
 
@@ -110,7 +115,11 @@ namespace bsm
             typedef std::vector<const Electron *> GoodElectrons;
             typedef std::vector<const Muon *> GoodMuons;
             typedef std::vector<CorrectedJet> GoodJets;
-            typedef LorentzVectorPtr GoodMET;
+
+            // Missing energy corrected with all jets: null if there are no
+            // corrected jets in event
+            //
+            typedef const LorentzVector *GoodMET;
 
             // first    Number of b-tagged jets
             // second   event weight
@@ -142,6 +151,14 @@ namespace bsm
                 SELECTIONS // this item should always be the last one
             };
 
+            // Event category is a pair of lepton channel and W flavor.
+            // Flavor is WJETS for all events if W flavor split is disabled
+            //
+            enum
+            {
+                CATEGORIES = (MUON + 1) * (WLIGHT + 1)
+            };
+
             SynchSelector();
             SynchSelector(const SynchSelector &);
 
@@ -167,6 +184,15 @@ namespace bsm
 
             CutflowPtr cutflow() const;
 
+            // Categories are available only if enabled. Category of the
+            // last event is valid only if event passed the W flavor split
+            //
+            bool categories() const;
+            uint32_t category() const;
+            CutflowPtr cutflow(const uint32_t &category) const;
+
+            static std::string categoryName(const uint32_t &category);
+
             const GoodPrimaryVertices &goodPrimaryVertices() const;
             const GoodElectrons &goodElectrons() const;
             const GoodMuons &goodMuons() const;
@@ -176,6 +202,14 @@ namespace bsm
 
             GoodJets::const_iterator closestJet() const;
 
+            // Kinematics of the selected objects: filled once the event
+            // passes the lepton cut
+            //
+            const EventKinematics &kinematics() const;
+
+            // Lepton mode of the last event: it is assigned per event if
+            // categories are enabled
+            //
             LeptonMode leptonMode() const;
             CutMode cutMode() const;
             bool qcdTemplate() const;
@@ -206,6 +240,7 @@ namespace bsm
             virtual void setInvertChi2(const bool &);
 
             virtual void setWflavor(const Wflavor &);
+            virtual void setCategories(const bool &);
 
             // Jet Energy Correction Delegate interface
             //
@@ -217,9 +252,13 @@ namespace bsm
 
             virtual void setChildCorrection();
 
+            virtual void setCorrectionGrid(const bool &validate);
+
             // Trigger Delegater interface
             //
             virtual void setTrigger(const Trigger &trigger);
+            virtual void setElectronTrigger(const Trigger &trigger);
+            virtual void setMuonTrigger(const Trigger &trigger);
 
             // Selector interface
             //
@@ -246,6 +285,11 @@ namespace bsm
             bool splitWflavor(const Event *); // use event jets to split sample
             bool splitWflavor(); // use good jes to split sample
             bool triggers(const Event *);
+
+            // Lepton channel triggers are used if set, otherwise the common
+            // triggers are applied
+            //
+            bool passTriggers(const Event *, const LeptonMode &) const;
             bool primaryVertices(const Event *);
             bool jets(const Event *);
             bool lepton();
@@ -266,11 +310,28 @@ namespace bsm
 
             void invalidate_cache();
 
+            // Apply cutflow and category cutflow if event is categorized.
+            // Otherwise the cut is replayed once event category is known
+            //
+            void applyCutflow(const Selection &);
+            void applyCategoryCutflow(const Selection &);
+            void categorize();
+
             LeptonMode _lepton_mode;
             CutMode _cut_mode;
 
             CutflowPtr _cutflow;
 
+            typedef std::vector<CutflowPtr> CategoryCutflows;
+
+            bool _categories;
+            CategoryCutflows _category_cutflows;
+
+            LeptonMode _event_lepton_mode;
+            Wflavor _event_wflavor;
+            bool _is_categorized;
+            uint32_t _event_cuts; // passed cuts before event is categorized
+
             boost::shared_ptr<PrimaryVertexSelector> _primary_vertex_selector;
             boost::shared_ptr<ElectronSelector> _electron_selector;
             boost::shared_ptr<MuonSelector> _muon_selector;
@@ -288,6 +349,23 @@ namespace bsm
             GoodJets _good_jets; // pT > 50
             GoodJets::const_iterator _closest_jet;
             GoodMET _good_met;
+            LorentzVector _corrected_met;
+
+            EventKinematics _kinematics;
+            EventKinematics::Leptons _kinematics_leptons;
+
+            // Objects arrays and masks for batch selectors. These are
+            // reused between events to avoid allocations
+            //
+            ElectronArrays _electron_arrays;
+            MuonArrays _muon_arrays;
+            P4Arrays _jet_arrays;
+            GoodJets _corrected_jets;
+
+            SelectionMask _electron_mask;
+            SelectionMask _muon_mask;
+            SelectionMask _nice_jet_mask;
+            SelectionMask _good_jet_mask;
 
             // cuts
             //
@@ -307,6 +385,13 @@ namespace bsm
 
             typedef std::vector<uint64_t> Triggers;
             Triggers _triggers; // hashes of triggers to be passed
+            Triggers _electron_triggers;
+            Triggers _muon_triggers;
+
+            // Channel triggers decision of categorized event
+            //
+            bool _electron_triggers_pass;
+            bool _muon_triggers_pass;
 
             boost::shared_ptr<Btag> _btag;
 
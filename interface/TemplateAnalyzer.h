@@ -12,7 +12,6 @@
 
 #include <iosfwd>
 #include <map>
-#include <sstream>
 #include <utility>
 
 #include <boost/shared_ptr.hpp>
@@ -23,10 +22,15 @@
 #include "interface/Algorithm.h"
 #include "interface/Analyzer.h"
 #include "interface/AppController.h"
+#include "interface/Bootstrap.h"
 #include "interface/Cut.h"
 #include "interface/DecayGenerator.h"
+#include "interface/EventList.h"
+#include "interface/GenDecay.h"
+#include "interface/OutputRegistry.h"
 #include "interface/Pileup.h"
 #include "interface/SynchSelector.h"
+#include "interface/ThetaInput.h"
 #include "interface/bsm_fwd.h"
 
 namespace bsm
@@ -137,6 +141,58 @@ namespace bsm
                                                const Chi2Discriminators &htop)
             {
             }
+
+            virtual void setReconstructionMaxJets(const uint32_t &)
+            {
+            }
+
+            virtual void setReconstructionComparison()
+            {
+            }
+
+            virtual void setEventList(const std::string &file_name)
+            {
+            }
+
+            virtual void setEventListBinary()
+            {
+            }
+
+            virtual void setEventListBufferSize(const uint32_t &)
+            {
+            }
+
+            virtual void setSummaries()
+            {
+            }
+
+            virtual void setBootstrap(const uint32_t &replicas)
+            {
+            }
+
+            virtual void setCategories()
+            {
+            }
+
+            virtual void setThetaInput(const std::string &file_name)
+            {
+            }
+
+            virtual void setThetaChannel(const std::string &channel)
+            {
+            }
+
+            virtual void setThetaProcess(const std::string &process)
+            {
+            }
+
+            virtual void setThetaSystematic(const std::string &systematic)
+            {
+            }
+
+            virtual void setThetaScale(const float &scale)
+            {
+            }
     };
 
     class TemplatesOptions : public Options
@@ -165,6 +221,19 @@ namespace bsm
             void setCollimatedSimpleReconstructionWithTopMass();
             void setReconstructionWithCollimatedTops();
             void setChi2Reconstruction(const std::string &);
+            void setReconstructionMaxJets(const uint32_t &);
+            void setReconstructionComparison();
+            void setEventList(const std::string &);
+            void setEventListBinary();
+            void setEventListBufferSize(const uint32_t &);
+            void setSummaries();
+            void setBootstrap(const uint32_t &);
+            void setCategories();
+            void setThetaInput(const std::string &);
+            void setThetaChannel(const std::string &);
+            void setThetaProcess(const std::string &);
+            void setThetaSystematic(const std::string &);
+            void setThetaScale(const float &);
 
             TemplatesDelegate *_delegate;
 
@@ -208,6 +277,35 @@ namespace bsm
             virtual void setReconstructionWithCollimatedTops();
             virtual void setChi2Reconstruction(const Chi2Discriminators &ltop,
                                                const Chi2Discriminators &htop);
+            virtual void setReconstructionMaxJets(const uint32_t &);
+            virtual void setReconstructionComparison();
+            virtual void setEventList(const std::string &file_name);
+            virtual void setEventListBinary();
+            virtual void setEventListBufferSize(const uint32_t &);
+            virtual void setSummaries();
+            virtual void setBootstrap(const uint32_t &replicas);
+            virtual void setCategories();
+            virtual void setThetaInput(const std::string &file_name);
+            virtual void setThetaChannel(const std::string &channel);
+            virtual void setThetaProcess(const std::string &process);
+            virtual void setThetaSystematic(const std::string &systematic);
+            virtual void setThetaScale(const float &scale);
+
+            // Merge per thread parts of the reconstructed events list into
+            // the file. Call once all threads are merged. Nothing is done
+            // and true is returned if the list is disabled
+            //
+            bool saveEventList();
+
+            // Write mttbar and htlep templates into the theta input. Call
+            // once all threads are merged. Nothing is done and true is
+            // returned if theta input is disabled
+            //
+            bool saveThetaInput();
+
+            // Histograms, cutflows and monitors written by AppController
+            //
+            virtual const OutputRegistry *outputs() const;
 
             const H1Ptr cutflow() const;
 
@@ -283,6 +381,28 @@ namespace bsm
 
             const P4MonitorPtr ltopJet1() const;
 
+            // Per category cutflows are available only if categories are
+            // enabled. Category histograms and cutflows are saved with the
+            // outputs
+            //
+            bool categories() const;
+
+            const H1Ptr cutflow(const uint32_t &category) const;
+
+            // Reconstruction comparison: every requested reconstructor is
+            // run over the same hypotheses. Histograms are filled for
+            // events passing the selector with valid reconstruction
+            //
+            bool compareReconstructions() const;
+
+            uint32_t reconstructions() const;
+            std::string reconstructionName(const uint32_t &) const;
+
+            const H1Ptr reconstructionMttbar(const uint32_t &) const;
+            const H1Ptr reconstructionLtopMass(const uint32_t &) const;
+            const H1Ptr reconstructionHtopMass(const uint32_t &) const;
+            const H1Ptr reconstructionHtopNjets(const uint32_t &) const;
+
             JetEnergyCorrectionDelegate *getJetEnergyCorrectionDelegate() const;
             JetEnergyResolutionDelegate *getJERDelegate() const;
             SynchSelectorDelegate *getSynchSelectorDelegate() const;
@@ -310,25 +430,48 @@ namespace bsm
         private:
             typedef boost::shared_ptr<H1Proxy> H1ProxyPtr;
             typedef boost::shared_ptr<H2Proxy> H2ProxyPtr;
-            typedef ::google::protobuf::RepeatedPtrField<GenParticle>
-                GenParticles;
 
             typedef ResonanceReconstructor::Mttbar Mttbar;
+            typedef MultiResonanceReconstructor::Mttbars Mttbars;
+
+            typedef std::vector<H1ProxyPtr> CategoryH1Proxies;
+
+            // Register output histograms: called by every constructor once
+            // histograms are booked or cloned
+            //
+            void registerOutputs();
+            void registerBootstrapOutputs();
+            void registerCategoryOutputs();
+            void registerReconstructionOutputs(const uint32_t &);
+
+            void bookCategories(CategoryH1Proxies &,
+                                const uint32_t &bins,
+                                const float &min,
+                                const float &max);
+
+            void cloneHistograms(CategoryH1Proxies &,
+                                 const CategoryH1Proxies &);
+
+            void setReconstructor(ResonanceReconstructor *,
+                                  const std::string &name);
+            void addReconstruction(const std::string &name);
 
             void fillDrVsPtrel();
             void fillHtlep();
 
             Mttbar mttbar() const;
+            Mttbars mttbars() const;
+            void fillReconstructions(const Mttbars &);
             void monitorJets();
 
+            const LorentzVector &leptonP4() const;
+
             float htlepValue() const;
             float htallValue() const;
 
             bool isGoodLepton() const;
 
-            WDecay eventDecay(const Event *) const;
-            WDecay decayType(const GenParticle &) const;
-            WDecay wdecayType(const GenParticle &) const;
+            WDecay eventDecay(const Event *);
 
             void invalidate_cache();
 
@@ -337,11 +480,6 @@ namespace bsm
             boost::shared_ptr<SynchSelector> _synch_selector;
             boost::shared_ptr<SynchSelector> _synch_selector_with_inverted_htlep;
 
-            // map: counter pointer to SynchSelector selection
-            //
-            std::map<const Counter *, uint32_t> _counters;
-            H1ProxyPtr _cutflow;
-
             H1ProxyPtr _npv;
             H1ProxyPtr _npv_with_pileup;
             H1ProxyPtr _njets;
@@ -398,6 +536,10 @@ namespace bsm
             bool _use_pileup;
             bool _wjets_input;
             bool _apply_wjet_correction;
+            uint32_t _reconstruction_max_jets;
+            bool _compare_reconstructions;
+
+            GenDecay _gen_decay;
 
             P4MonitorPtr _jet1;
             P4MonitorPtr _jet2;
@@ -425,12 +567,40 @@ namespace bsm
             H1ProxyPtr _njet2_dr_lepton_jet1_after_reconstruction;
             H1ProxyPtr _njet2_dr_lepton_jet2_after_reconstruction;
 
+            CategoryH1Proxies _category_njets;
+            CategoryH1Proxies _category_met;
+            CategoryH1Proxies _category_htlep_after_htlep;
+            CategoryH1Proxies _category_mttbar_after_htlep;
+
+            CategoryH1Proxies _category_htlep_before_htlep;
+            CategoryH1Proxies _category_htlep_before_htlep_noweight;
+            CategoryH1Proxies _category_mttbar_before_htlep;
+
             boost::shared_ptr<ResonanceReconstructor> _reconstructor;
 
+            boost::shared_ptr<MultiResonanceReconstructor> _reconstructions;
+            std::vector<std::string> _reconstruction_names;
+            CategoryH1Proxies _reconstruction_mttbar;
+            CategoryH1Proxies _reconstruction_ltop_mass;
+            CategoryH1Proxies _reconstruction_htop_mass;
+            CategoryH1Proxies _reconstruction_htop_njets;
+
             boost::shared_ptr<Cache<float> > _event_weight;
             boost::shared_ptr<Cache<float> > _event_weight_inverted_htlep;
 
-            std::ostringstream _out;
+            OutputRegistry _outputs;
+
+            boost::shared_ptr<EventList> _events;
+
+            // Poisson replicas of the theta templates
+            //
+            Bootstrap _bootstrap;
+            BootstrapH1Ptr _bootstrap_mttbar_before_htlep;
+            BootstrapH1Ptr _bootstrap_mttbar_after_htlep;
+            BootstrapH1Ptr _bootstrap_htlep_before_htlep;
+            BootstrapH1Ptr _bootstrap_htlep_after_htlep;
+
+            ThetaInput _theta_input;
     };
 }
 
@@ -0,0 +1,82 @@
+// Theta Input
+//
+// Write templates in the theta convention directly from the analyzer:
+//
+//      [channel]_[plot]__[process][__[systematic]__plus|minus]
+//
+// Templates are rebinned to the final binning and normalized with the
+// sample scale. The file is updated: jobs of different samples and
+// systematics may be run one after another into the same theta input
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#ifndef BSM_THETA_INPUT
+#define BSM_THETA_INPUT
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "interface/bsm_fwd.h"
+
+namespace bsm
+{
+    class ThetaInput
+    {
+        public:
+            typedef boost::shared_ptr<H1Proxy> H1ProxyPtr;
+
+            struct Template
+            {
+                Template(const std::string &plot,
+                         const H1ProxyPtr &histogram,
+                         const uint32_t &rebin = 1);
+
+                std::string plot;
+                H1ProxyPtr histogram;
+                uint32_t rebin;
+            };
+
+            typedef std::vector<Template> Templates;
+
+            ThetaInput();
+
+            // Theta input is disabled until both file and process are set
+            //
+            void setFile(const std::string &);
+            void setChannel(const std::string &);
+
+            // QCD from data (eleqcd) is not supported: exception is
+            // thrown
+            //
+            void setProcess(const std::string &);
+
+            // Systematic is given with the direction: jes+, pileup-.
+            // Exception is thrown if direction is missing
+            //
+            void setSystematic(const std::string &);
+
+            // Sample normalization: x-section * luminosity / events
+            //
+            void setScale(const float &);
+
+            bool isEnabled() const;
+
+            std::string name(const std::string &plot) const;
+
+            // Templates should be merged by the time of the call
+            //
+            bool save(const Templates &) const;
+
+        private:
+            std::string _file_name;
+            std::string _channel;
+            std::string _process;
+            std::string _systematic;
+            float _scale;
+    };
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include <string>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/thread_time.hpp>
 
 #include "interface/bsm_fwd.h"
 #include "bsm_core/interface/bsm_core_fwd.h"
@@ -81,6 +82,13 @@ namespace bsm
 
             AnalyzerPtr analyzer() const;
 
+            // Copy of the analyzer state. Events are processed under the
+            // thread lock: the copy is taken between events and the thread
+            // is paused only for the time of the clone. Null pointer is
+            // returned if thread is not started yet
+            //
+            AnalyzerPtr snapshot() const;
+
             // Scheule file for processing. Method does nothing is file
             // is already set but processing didn't start
             //
@@ -164,6 +172,13 @@ namespace bsm
 
             bool isAnalyzerReaderDelegate() const;
 
+            // Periodically merge copies of the running threads analyzers with
+            // the already finished ones and save the registered outputs in
+            // the file. Interval is in seconds, 0 disables snapshots
+            //
+            void setSnapshot(const uint32_t &interval,
+                             const std::string &file_name);
+
             // Schedule file for processing
             //
             void push(const std::string &file_name);
@@ -195,10 +210,16 @@ namespace bsm
             void instruct(AnalyzerOperation *operation);
 
             void run();
-            void wait();
+
+            // Return false if wait is interrupted by the snapshot timeout
+            //
+            bool wait();
 
             bool isRunning() const;
 
+            bool isSnapshotTime() const;
+            void snapshot();
+
             void onThreadWait();
             core::Thread *waitingThread();
 
@@ -232,6 +253,10 @@ namespace bsm
             boost::shared_ptr<Summary> _summary;
 
             bool _analyzer_is_reader_delegate;
+
+            uint32_t _snapshot_interval;
+            std::string _snapshot_file_name;
+            boost::system_time _next_snapshot;
     };
 }
 
@@ -31,6 +31,13 @@ namespace bsm
             virtual ~TriggerDelegate() {}
 
             virtual void setTrigger(const Trigger &) {}
+
+            // Triggers of one lepton channel replace the common triggers
+            // for events of the channel
+            //
+            virtual void setElectronTrigger(const Trigger &) {}
+            virtual void setMuonTrigger(const Trigger &) {}
+
             virtual void setFilter(const Hash &) {}
             virtual void setProducer(const Hash &) {}
     };
@@ -51,6 +58,8 @@ namespace bsm
             typedef std::vector<std::string> Triggers;
 
             void setTrigger(const Triggers &) const;
+            void setElectronTrigger(const Triggers &) const;
+            void setMuonTrigger(const Triggers &) const;
             void setFilter(std::string) const;
             void setProducer(std::string) const;
 
@@ -129,19 +129,17 @@ namespace bsm
     struct CorrectedPtLess
     {
         public:
+            // Cached corrected pT is compared
+            //
             virtual bool operator()(const CorrectedJet &v1, const CorrectedJet &v2);
-
-        private:
-            PtLess _pt_less;
     };
 
     struct CorrectedPtGreater
     {
         public:
+            // Cached corrected pT is compared
+            //
             virtual bool operator()(const CorrectedJet &v1, const CorrectedJet &v2);
-
-        private:
-            PtGreater _pt_greater;
     };
 
     struct PtGreaterSort
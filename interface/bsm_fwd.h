@@ -8,6 +8,10 @@
 #ifndef BSM_FWD
 #define BSM_FWD
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 
 namespace bsm
@@ -35,9 +39,20 @@ namespace bsm
     typedef boost::shared_ptr<Counter> CounterPtr;
     typedef boost::shared_ptr<Cut> CutPtr;
 
+    // Batch cuts: values of all objects are kept in one array and the
+    // selection result is stored in a mask (1 - selected, 0 - rejected)
+    //
+    typedef std::vector<float> CutValues;
+    typedef std::vector<uint8_t> SelectionMask;
+
     class ElectronSelector;
     class JetSelector;
     class P4Selector;
+    struct P4Arrays;
+    struct ElectronArrays;
+    struct MuonArrays;
+    struct KinematicsArrays;
+    class EventKinematics;
     class MultiplicityCutflow;
     class MuonSelector;
     class PrimaryVertexSelector;
@@ -74,6 +89,20 @@ namespace bsm
 
     class H1Proxy;
     class H2Proxy;
+    class OutputRegistry;
+
+    class Moments;
+    class QuantileSketch;
+    class StreamSummary;
+
+    typedef boost::shared_ptr<StreamSummary> StreamSummaryPtr;
+    typedef std::vector<std::pair<std::string, StreamSummaryPtr> >
+        NamedSummaries;
+
+    class Bootstrap;
+    class BootstrapH1;
+
+    class ThetaInput;
 
     class Summary;
     class Pileup;
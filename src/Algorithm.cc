@@ -7,6 +7,7 @@
 
 #include <cfloat>
 #include <iostream>
+#include <limits>
 
 #include <boost/pointer_cast.hpp>
 
@@ -65,12 +66,11 @@ NeutrinoReconstruct::Solutions
     {
         // Take only real part of the solution
         //
-        LorentzVectorPtr solution(new LorentzVector());
-        *solution = neutrino;
-        solution->set_pz(-B / A);
-        solution->set_e(magnitude(toVector(*solution)));
+        solutions.push_back(neutrino);
 
-        solutions.push_back(solution);
+        LorentzVector &solution = solutions.back();
+        solution.set_pz(-B / A);
+        solution.set_e(magnitude(toVector(solution)));
 
         _solutions = 0 > discriminant ? 0 : 1;
     }
@@ -78,19 +78,13 @@ NeutrinoReconstruct::Solutions
     {
         discriminant = sqrt(discriminant);
 
-        LorentzVectorPtr solution(new LorentzVector());
-        *solution = neutrino;
-        solution->set_pz((-B - discriminant) / A);
-        solution->set_e(magnitude(toVector(*solution)));
+        solutions.push_back(neutrino);
+        solutions.back().set_pz((-B - discriminant) / A);
+        solutions.back().set_e(magnitude(toVector(solutions.back())));
 
-        solutions.push_back(solution);
-
-        solution.reset(new LorentzVector());
-        *solution = neutrino;
-        solution->set_pz((-B + discriminant) / A);
-        solution->set_e(magnitude(toVector(*solution)));
-
-        solutions.push_back(solution);
+        solutions.push_back(neutrino);
+        solutions.back().set_pz((-B + discriminant) / A);
+        solutions.back().set_e(magnitude(toVector(solutions.back())));
 
         _solutions = 2;
     }
@@ -399,192 +393,173 @@ void JetIterator::operator++()
 
 // -- Resonance Reconstructor -------------------------------------------------
 //
-ResonanceReconstructor::Mttbar ResonanceReconstructor::run(
-        const LorentzVector &lepton,
-        const LorentzVector &met,
-        const SynchSelector::GoodJets &jets) const
-{
-    Mttbar result;
+// Best Solution should have minimun value of the DeltaRmin:
+//
+//  DeltaRmin = DeltaR(ltop, b) + DeltaR(ltop, l) + DeltaR(ltop, nu)
+//
+// and maximum value of the DeltaR between leptonic and hadronic
+// tops in case the same DeltaRmin is found:
+//
+//  DeltaRlh = DeltaR(ltop, htop)
+//
+class ResonanceReconstructor::DiscriminatorSearch:
+    public ResonanceReconstructor::Search
+{
+    public:
+        DiscriminatorSearch(const ResonanceReconstructor &reconstructor,
+                            const LorentzVector &lepton,
+                            const Neutrinos &neutrinos,
+                            const Generator &generator):
+            _reconstructor(reconstructor),
+            _lepton(lepton),
+            _neutrinos(neutrinos),
+            _generator(generator)
+        {
+        }
 
-    // Reconstruct the neutrino pZ and keep solutions in vector for later
-    // use
-    //
-    NeutrinoReconstruct neutrinoReconstruct;
-    NeutrinoReconstruct::Solutions neutrinos =
-        neutrinoReconstruct(lepton, met);
+        virtual void add(const Generator &, const Generator::Hypothesis &);
+        virtual Mttbar result() const;
 
-    result.solutions = neutrinoReconstruct.solutions();
+    private:
+        // Legs jets are kept as generator masks and are copied only once
+        // the search is over
+        //
+        struct Solution
+        {
+            Solution():
+                htop_discriminator(0),
+                ltop_discriminator(FLT_MAX),
+                htop_njets(0),
+                htop_mask(0),
+                ltop_mask(0),
+                index(0),
+                valid(false)
+            {
+            }
 
-    for(NeutrinoReconstruct::Solutions::const_iterator neutrino =
-                neutrinos.begin();
-            neutrinos.end() != neutrino;
-            ++neutrino)
-    {
-        result.neutrinos.push_back(**neutrino);
-    }
+            LorentzVector ltop; // Reconstructed leptonic leg
+            LorentzVector htop; // Reconstructed hadronic leg
+            LorentzVector missing_energy;
 
-    // Prepare generator and loop over all hypotheses of the decay
-    // (different jets assignment to leptonic/hadronic legs)
-    //
-    Generator generator;
-    generator.init(jets);
+            LorentzVector ltop_jet; // Used jet in the ltop reconstruction
 
-    // Best Solution should have minimun value of the DeltaRmin:
-    //
-    //  DeltaRmin = DeltaR(ltop, b) + DeltaR(ltop, l) + DeltaR(ltop, nu)
-    //
-    // and maximum value of the DeltaR between leptonic and hadronic
-    // tops in case the same DeltaRmin is found:
-    //
-    //  DeltaRlh = DeltaR(ltop, htop)
-    //
-    struct Solution
-    {
-        Solution():
-            htop_discriminator(0),
-            ltop_discriminator(FLT_MAX),
-            htop_njets(0),
-            valid(false)
-        {
-        }
+            float htop_discriminator;
+            float ltop_discriminator;
+            int htop_njets;
 
-        LorentzVector ltop; // Reconstructed leptonic leg
-        LorentzVector htop; // Reconstructed hadronic leg
-        LorentzVector missing_energy;
+            uint64_t htop_mask;
+            uint64_t ltop_mask;
 
-        CorrectedJets htop_jets;
-        CorrectedJets ltop_jets;
+            uint64_t index; // Generator hypothesis index
 
-        LorentzVector ltop_jet; // Used jet in the ltop reconstruction
+            bool valid;
+        };
 
-        float htop_discriminator;
-        float ltop_discriminator;
-        int htop_njets;
+        void copyJets(CorrectedJets &, const uint64_t &mask) const;
 
-        bool valid;
-    } best_solution;
+        const ResonanceReconstructor &_reconstructor;
+        const LorentzVector &_lepton;
+        const Neutrinos &_neutrinos;
+        const Generator &_generator;
 
-    // Loop over all possible hypotheses and pick the best one
-    // Note: take into account all reconstructed neutrino solutions
-    //
-    do
-    {
-        Generator::Hypothesis hypothesis = generator.hypothesis();
+        Solution _best_solution;
+};
 
-        if (!isValidHadronicSide(lepton, hypothesis.hadronic)
-                || !isValidLeptonicSide(lepton, hypothesis.leptonic)
-                || !isValidNeutralSide(lepton, hypothesis.neutral))
+void ResonanceReconstructor::DiscriminatorSearch::add(
+        const Generator &generator,
+        const Generator::Hypothesis &hypothesis)
+{
+    if (!_reconstructor.isValidHadronicSide(_lepton, hypothesis.hadronic)
+            || !_reconstructor.isValidLeptonicSide(_lepton, hypothesis.leptonic)
+            || !_reconstructor.isValidNeutralSide(_lepton, hypothesis.neutral))
 
-                continue;
+            return;
 
-        // Leptonic Top p4 = leptonP4 + nuP4 + bP4
-        // where bP4 is:
-        //  - b-tagged jet
-        //  - otherwise, the hardest jet (highest pT)
-        //
-        LorentzVector ltop = lepton;
-        LorentzVector ltop_jet = getLeptonicJet(hypothesis.leptonic);
-        ltop += ltop_jet;
+    // Leptonic Top p4 = leptonP4 + nuP4 + bP4
+    // where bP4 is:
+    //  - b-tagged jet
+    //  - otherwise, the hardest jet (highest pT)
+    //
+    LorentzVector ltop = _lepton;
+    LorentzVector ltop_jet = _reconstructor.getLeptonicJet(hypothesis.leptonic);
+    ltop += ltop_jet;
 
-        // the neutrino will be taken into account later
-        //
+    // the neutrino will be taken into account later
+    //
 
-        // htop is a sum of all jet p4s assigned to the hadronic leg
-        //
-        LorentzVector htop;
-        for(Generator::Iterators::const_iterator jet =
-                    hypothesis.hadronic.begin();
-                hypothesis.hadronic.end() != jet;
-                ++jet)
-        {
-            htop += *(*jet)->corrected_p4;
-        }
+    // htop is a sum of all jet p4s assigned to the hadronic leg
+    //
+    const LorentzVector &htop = generator.p4(Generator::HADRONIC);
 
-        // Take into account all neutrino solutions. Solutions are kept in
-        // a vector of pointer
-        //
-        for(NeutrinoReconstruct::Solutions::const_iterator neutrino =
-                    neutrinos.begin();
-                neutrinos.end() != neutrino;
-                ++neutrino)
-        {
-            const LorentzVector &neutrino_p4 = *(*neutrino);
+    // Take into account all neutrino solutions
+    //
+    for(Neutrinos::const_iterator neutrino = _neutrinos.begin();
+            _neutrinos.end() != neutrino;
+            ++neutrino)
+    {
+        const LorentzVector &neutrino_p4 = *neutrino;
 
-            LorentzVector ltop_tmp = ltop;
-            ltop_tmp += neutrino_p4;
+        LorentzVector ltop_tmp = ltop;
+        ltop_tmp += neutrino_p4;
 
-            const float ltop_discriminator =
-                getLeptonicDiscriminator(ltop_tmp,
-                                         lepton,
-                                         neutrino_p4,
-                                         ltop_jet);
+        const float ltop_discriminator =
+            _reconstructor.getLeptonicDiscriminator(ltop_tmp,
+                                                    _lepton,
+                                                    neutrino_p4,
+                                                    ltop_jet);
 
-            const float htop_discriminator =
-                getHadronicDiscriminator(ltop_tmp, htop, hypothesis.hadronic);
+        const float htop_discriminator =
+            _reconstructor.getHadronicDiscriminator(ltop_tmp,
+                                                    htop,
+                                                    hypothesis.hadronic);
 
-            if (ltop_discriminator < best_solution.ltop_discriminator
-                    || (ltop_discriminator == best_solution.ltop_discriminator
-                        && htop_discriminator > best_solution.htop_discriminator))
-            {
-                best_solution.htop_discriminator = htop_discriminator;
-                best_solution.ltop_discriminator = ltop_discriminator;
-                best_solution.ltop = ltop_tmp;
-                best_solution.ltop_jet = ltop_jet;
-                best_solution.htop = htop;
-                best_solution.missing_energy = neutrino_p4;
-                best_solution.htop_njets = hypothesis.hadronic.size();
-
-                best_solution.htop_jets.clear();
-                for(Generator::Iterators::const_iterator jet =
-                            hypothesis.hadronic.begin();
-                        hypothesis.hadronic.end() != jet;
-                        ++jet)
-                {
-                    best_solution.htop_jets.push_back(*(*jet));
-                }
-
-                best_solution.ltop_jets.clear();
-                for(Generator::Iterators::const_iterator jet =
-                            hypothesis.leptonic.begin();
-                        hypothesis.leptonic.end() != jet;
-                        ++jet)
-                {
-                    best_solution.ltop_jets.push_back(*(*jet));
-                }
-
-                best_solution.valid = true;
-            }
+        // Hypotheses are not generated in the index order: equal
+        // solutions are resolved in favour of the smaller index
+        //
+        Solution &best_solution = _best_solution;
+        if (ltop_discriminator < best_solution.ltop_discriminator
+                || (ltop_discriminator == best_solution.ltop_discriminator
+                    && (htop_discriminator > best_solution.htop_discriminator
+                        || (htop_discriminator == best_solution.htop_discriminator
+                            && best_solution.valid
+                            && generator.index() < best_solution.index))))
+        {
+            best_solution.htop_discriminator = htop_discriminator;
+            best_solution.ltop_discriminator = ltop_discriminator;
+            best_solution.ltop = ltop_tmp;
+            best_solution.ltop_jet = ltop_jet;
+            best_solution.htop = htop;
+            best_solution.missing_energy = neutrino_p4;
+            best_solution.htop_njets = hypothesis.hadronic.size();
+            best_solution.htop_mask = generator.mask(Generator::HADRONIC);
+            best_solution.ltop_mask = generator.mask(Generator::LEPTONIC);
+            best_solution.index = generator.index();
+
+            best_solution.valid = true;
         }
     }
-    while(generator.next());
+}
+
+ResonanceReconstructor::Mttbar
+    ResonanceReconstructor::DiscriminatorSearch::result() const
+{
+    Mttbar result;
 
     // Best Solution is found
     //
+    const Solution &best_solution = _best_solution;
     if (best_solution.valid)
     {
         result.mttbar = best_solution.ltop + best_solution.htop;
-        result.wlep = best_solution.missing_energy + lepton;
+        result.wlep = best_solution.missing_energy + _lepton;
         result.neutrino = best_solution.missing_energy;
         result.ltop = best_solution.ltop;
         result.ltop_jet = best_solution.ltop_jet;
         result.htop = best_solution.htop;
         result.htop_njets = best_solution.htop_njets;
 
-        result.htop_jets.clear();
-        for(CorrectedJets::const_iterator jet = best_solution.htop_jets.begin();
-                best_solution.htop_jets.end() != jet;
-                ++jet)
-        {
-            result.htop_jets.push_back(*jet);
-        }
-
-        result.ltop_jets.clear();
-        for(CorrectedJets::const_iterator jet = best_solution.ltop_jets.begin();
-                best_solution.ltop_jets.end() != jet;
-                ++jet)
-        {
-            result.ltop_jets.push_back(*jet);
-        }
+        copyJets(result.htop_jets, best_solution.htop_mask);
+        copyJets(result.ltop_jets, best_solution.ltop_mask);
 
         sort(result.htop_jets.begin(), result.htop_jets.end(), CorrectedPtGreater()); 
         sort(result.ltop_jets.begin(), result.ltop_jets.end(), CorrectedPtGreater()); 
@@ -595,6 +570,82 @@ ResonanceReconstructor::Mttbar ResonanceReconstructor::run(
     return result;
 }
 
+void ResonanceReconstructor::DiscriminatorSearch::copyJets(CorrectedJets &jets,
+        const uint64_t &mask) const
+{
+    jets.clear();
+    for(uint32_t object = 0; _generator.objects() > object; ++object)
+    {
+        if (mask & (1ull << object))
+            jets.push_back(_generator.object(object));
+    }
+}
+
+ResonanceReconstructor::ResonanceReconstructor():
+    _max_jets(0)
+{
+}
+
+ResonanceReconstructor::Mttbar ResonanceReconstructor::run(
+        const LorentzVector &lepton,
+        const LorentzVector &met,
+        const SynchSelector::GoodJets &jets) const
+{
+    // Reconstruct the neutrino pZ and keep solutions in vector for later
+    // use
+    //
+    NeutrinoReconstruct neutrinoReconstruct;
+    Neutrinos neutrinos = neutrinoReconstruct(lepton, met);
+
+    // Prepare generator and loop over all hypotheses of the decay
+    // (different jets assignment to leptonic/hadronic legs)
+    //
+    Generator generator(maxJets());
+    generator.init(jets);
+
+    SearchPtr search = this->search(lepton, neutrinos, generator);
+
+    // Loop over all possible hypotheses and pick the best one
+    // Note: take into account all reconstructed neutrino solutions
+    //
+    Generator::Hypothesis hypothesis;
+    do
+    {
+        generator.hypothesis(hypothesis);
+
+        search->add(generator, hypothesis);
+    }
+    while(generator.next());
+
+    Mttbar result = search->result();
+
+    result.solutions = neutrinoReconstruct.solutions();
+    result.neutrinos = neutrinos;
+
+    return result;
+}
+
+ResonanceReconstructor::SearchPtr ResonanceReconstructor::search(
+        const LorentzVector &lepton,
+        const Neutrinos &neutrinos,
+        const Generator &generator) const
+{
+    return SearchPtr(new DiscriminatorSearch(*this,
+                                             lepton,
+                                             neutrinos,
+                                             generator));
+}
+
+void ResonanceReconstructor::setMaxJets(const uint32_t &max_jets)
+{
+    _max_jets = max_jets;
+}
+
+uint32_t ResonanceReconstructor::maxJets() const
+{
+    return _max_jets;
+}
+
 void ResonanceReconstructor::print(std::ostream &out) const
 {
     out << "ResonanceReconstructor" << endl;
@@ -602,6 +653,135 @@ void ResonanceReconstructor::print(std::ostream &out) const
 
 
 
+// -- Multi Resonance Reconstructor -------------------------------------------
+//
+MultiResonanceReconstructor::MultiResonanceReconstructor():
+    _max_jets(0)
+{
+}
+
+MultiResonanceReconstructor::MultiResonanceReconstructor(
+        const MultiResonanceReconstructor &object):
+    _max_jets(object._max_jets)
+{
+    for(Reconstructors::const_iterator reconstructor =
+                object._reconstructors.begin();
+            object._reconstructors.end() != reconstructor;
+            ++reconstructor)
+    {
+        add(dynamic_pointer_cast<ResonanceReconstructor>(
+                    (*reconstructor)->clone()));
+    }
+}
+
+void MultiResonanceReconstructor::add(
+        const ResonanceReconstructorPtr &reconstructor)
+{
+    _reconstructors.push_back(reconstructor);
+    monitor(reconstructor);
+}
+
+const MultiResonanceReconstructor::Reconstructors &
+    MultiResonanceReconstructor::reconstructors() const
+{
+    return _reconstructors;
+}
+
+void MultiResonanceReconstructor::setMaxJets(const uint32_t &max_jets)
+{
+    _max_jets = max_jets;
+}
+
+uint32_t MultiResonanceReconstructor::maxJets() const
+{
+    return _max_jets;
+}
+
+MultiResonanceReconstructor::Mttbars MultiResonanceReconstructor::run(
+        const LorentzVector &lepton,
+        const LorentzVector &met,
+        const SynchSelector::GoodJets &jets) const
+{
+    typedef ResonanceReconstructor::Neutrinos Neutrinos;
+    typedef ResonanceReconstructor::Generator Generator;
+    typedef std::vector<ResonanceReconstructor::SearchPtr> Searches;
+
+    // Neutrino solutions are reconstructed once for all reconstructors
+    //
+    NeutrinoReconstruct neutrinoReconstruct;
+    Neutrinos neutrinos = neutrinoReconstruct(lepton, met);
+
+    Generator generator(maxJets());
+    generator.init(jets);
+
+    Searches searches;
+    searches.reserve(_reconstructors.size());
+    for(Reconstructors::const_iterator reconstructor =
+                _reconstructors.begin();
+            _reconstructors.end() != reconstructor;
+            ++reconstructor)
+    {
+        searches.push_back((*reconstructor)->search(lepton,
+                                                    neutrinos,
+                                                    generator));
+    }
+
+    // Every hypothesis is generated once and tested by all reconstructors
+    //
+    Generator::Hypothesis hypothesis;
+    do
+    {
+        generator.hypothesis(hypothesis);
+
+        for(Searches::const_iterator search = searches.begin();
+                searches.end() != search;
+                ++search)
+        {
+            (*search)->add(generator, hypothesis);
+        }
+    }
+    while(generator.next());
+
+    Mttbars results;
+    results.reserve(searches.size());
+    for(Searches::const_iterator search = searches.begin();
+            searches.end() != search;
+            ++search)
+    {
+        results.push_back((*search)->result());
+
+        results.back().solutions = neutrinoReconstruct.solutions();
+        results.back().neutrinos = neutrinos;
+    }
+
+    return results;
+}
+
+uint32_t MultiResonanceReconstructor::id() const
+{
+    return core::ID<MultiResonanceReconstructor>::get();
+}
+
+MultiResonanceReconstructor::ObjectPtr
+    MultiResonanceReconstructor::clone() const
+{
+    return ObjectPtr(new MultiResonanceReconstructor(*this));
+}
+
+void MultiResonanceReconstructor::print(std::ostream &out) const
+{
+    out << "MultiResonanceReconstructor" << endl;
+    for(Reconstructors::const_iterator reconstructor =
+                _reconstructors.begin();
+            _reconstructors.end() != reconstructor;
+            ++reconstructor)
+    {
+        out << " " << **reconstructor;
+    }
+}
+
+
+
 // -- Simple Resonance Reconstructor ------------------------------------------ 
 //
 uint32_t SimpleResonanceReconstructor::id() const
@@ -642,22 +822,7 @@ bool SimpleResonanceReconstructor::isValidNeutralSide(const LorentzVector &,
 bsm::LorentzVector SimpleResonanceReconstructor::getLeptonicJet(
         const Iterators &jets) const
 {
-    const CorrectedJet *hardest_jet = 0;
-    float highest_pt = 0;
-
-    // Select the hardest jet (highest pT)
-    // Note: hypothesis keeps vector of iterators to Correcte Jets.
-    //       Corrected jet has a pointer to the original jet and
-    //       corrected P4
-    //
-    for(Iterators::const_iterator jet = jets.begin(); jets.end() != jet; ++jet)
-    {
-        const float jet_pt = pt(*(*jet)->corrected_p4);
-        if (jet_pt > highest_pt)
-            hardest_jet = &*(*jet);
-    }
-
-    return *hardest_jet->corrected_p4;
+    return findLeptonicJet(jets)->corrected_p4;
 }
 
 float SimpleResonanceReconstructor::getLeptonicDiscriminator(
@@ -677,6 +842,27 @@ float SimpleResonanceReconstructor::getHadronicDiscriminator(
     return dr(ltop, htop);
 }
 
+const CorrectedJet *SimpleResonanceReconstructor::findLeptonicJet(
+        const Iterators &jets) const
+{
+    const CorrectedJet *hardest_jet = 0;
+    float highest_pt = 0;
+
+    // Select the hardest jet (highest pT)
+    // Note: hypothesis keeps vector of iterators to Correcte Jets.
+    //       Corrected jet has a pointer to the original jet and
+    //       corrected P4
+    //
+    for(Iterators::const_iterator jet = jets.begin(); jets.end() != jet; ++jet)
+    {
+        const float jet_pt = (*jet)->corrected_pt;
+        if (jet_pt > highest_pt)
+            hardest_jet = &*(*jet);
+    }
+
+    return hardest_jet;
+}
+
 
 
 // -- Btag Resonance Reconstructor -------------------------------------------- 
@@ -731,18 +917,18 @@ bsm::LorentzVector BtagResonanceReconstructor::getLeptonicJet(
     //
     for(Iterators::const_iterator jet = jets.begin(); jets.end() != jet; ++jet)
     {
-        if (isBtagJet((*jet)->jet))
+        if (isBtagJet(**jet))
         {
             hardest_jet = &*(*jet);
             break;
         }
 
-        const float jet_pt = pt(*(*jet)->corrected_p4);
+        const float jet_pt = (*jet)->corrected_pt;
         if (jet_pt > highest_pt)
             hardest_jet = &*(*jet);
     }
 
-    return *hardest_jet->corrected_p4;
+    return hardest_jet->corrected_p4;
 }
 
 uint32_t BtagResonanceReconstructor::countBtags(const Iterators &jets) const
@@ -750,28 +936,17 @@ uint32_t BtagResonanceReconstructor::countBtags(const Iterators &jets) const
     uint32_t btagged_jets = 0;
     for(Iterators::const_iterator jet = jets.begin(); jets.end() != jet; ++jet)
     {
-        if (isBtagJet((*jet)->jet))
+        if (isBtagJet(**jet))
             ++btagged_jets;
     }
 
     return btagged_jets;
 }
 
-bool BtagResonanceReconstructor::isBtagJet(const Jet *jet) const
+bool BtagResonanceReconstructor::isBtagJet(const CorrectedJet &jet) const
 {
-    typedef ::google::protobuf::RepeatedPtrField<Jet::BTag> BTags;
-
-    for(BTags::const_iterator btag = jet->btag().begin();
-            jet->btag().end() != btag;
-            ++btag)
-    {
-        if (Jet::BTag::SSVHE == btag->type())
-        {
-            return 1.74 < btag->discriminator();
-        }
-    }
-
-    return false;
+    return jet.has_ssvhe
+        && 1.74 < jet.ssvhe;
 }
 
 
@@ -803,7 +978,7 @@ bool SimpleDrResonanceReconstructor::isValidHadronicSide(const LorentzVector &le
             result && jets.end() != jet;
             ++jet)
     {
-        if (_hadronic_dr > dr(lepton, *(*jet)->corrected_p4))
+        if (_hadronic_dr > dr(lepton, (*jet)->corrected_p4))
             result = false;
     }
 
@@ -818,7 +993,7 @@ bool SimpleDrResonanceReconstructor::isValidLeptonicSide(const LorentzVector &le
             result && jets.end() != jet;
             ++jet)
     {
-        if (_leptonic_dr < dr(lepton, *(*jet)->corrected_p4))
+        if (_leptonic_dr < dr(lepton, (*jet)->corrected_p4))
             result = false;
     }
 
@@ -833,8 +1008,8 @@ bool SimpleDrResonanceReconstructor::isValidNeutralSide(const LorentzVector &lep
             result && jets.end() != jet;
             ++jet)
     {
-        if (_leptonic_dr > dr(lepton, *(*jet)->corrected_p4)
-                || _hadronic_dr < dr(lepton, *(*jet)->corrected_p4))
+        if (_leptonic_dr > dr(lepton, (*jet)->corrected_p4)
+                || _hadronic_dr < dr(lepton, (*jet)->corrected_p4))
             result = false;
     }
 
@@ -870,7 +1045,7 @@ bool HemisphereResonanceReconstructor::isValidHadronicSide(const LorentzVector &
             result && jets.end() != jet;
             ++jet)
     {
-        if (_half_pi > angle(lepton, *(*jet)->corrected_p4))
+        if (_half_pi > angle(lepton, (*jet)->corrected_p4))
             result = false;
     }
 
@@ -885,7 +1060,7 @@ bool HemisphereResonanceReconstructor::isValidLeptonicSide(const LorentzVector &
             result && jets.end() != jet;
             ++jet)
     {
-        if (_half_pi < angle(lepton, *(*jet)->corrected_p4))
+        if (_half_pi < angle(lepton, (*jet)->corrected_p4))
             result = false;
     }
 
@@ -1091,7 +1266,7 @@ float CollimatedSimpleResonanceReconstructorWithMass::getHadronicDiscriminator(
                 htop_jets.end() != jet;
                 ++jet)
         {
-            hadronic_dr += dr(htop, *(*jet)->corrected_p4);
+            hadronic_dr += dr(htop, (*jet)->corrected_p4);
         }
 
         discriminator *= 1. / hadronic_dr;
@@ -1175,6 +1350,7 @@ float ResonanceReconstructorWithCollimatedTops::getLeptonicDiscriminator(
 
 Chi2Hypothesis::Chi2Hypothesis(const DecayHypothesis *hypothesis):
     valid(false),
+    index(0),
     ltop_chi2(FLT_MAX),
     htop_chi2(FLT_MAX)
 {
@@ -1299,7 +1475,7 @@ float HtopDeltaRSumDiscriminator::calculate(const Chi2Hypothesis &hypothesis)
             hypothesis.htop_jets.end() != jet;
             ++jet)
     {
-        discriminator += dr(top, *(*jet)->corrected_p4);
+        discriminator += dr(top, (*jet)->corrected_p4);
     }
 
     // Somehow g++ 4.3.4 can not find function in the base class
@@ -1320,176 +1496,200 @@ HtopDeltaRSumDiscriminator::ObjectPtr HtopDeltaRSumDiscriminator::clone() const
 
 // -- Reconstruction with ltop/htop chi2 ---------------------------------------
 //
-Chi2ResonanceReconstructor::Chi2ResonanceReconstructor(
-        const Chi2ResonanceReconstructor &object)
+class Chi2ResonanceReconstructor::Chi2Search:
+    public ResonanceReconstructor::Search
 {
-    for(Chi2Discriminators::const_iterator ltop =
-            object._ltop_discriminators.begin();
-        object._ltop_discriminators.end() != ltop;
-        ++ltop)
-    {
-        _ltop_discriminators.push_back(
-                dynamic_pointer_cast<Chi2Discriminator>((*ltop)->clone()));
-    }
+    public:
+        Chi2Search(const Chi2ResonanceReconstructor &,
+                   const LorentzVector &lepton,
+                   const Neutrinos &,
+                   const Generator &);
 
-    for(Chi2Discriminators::const_iterator htop =
-            object._htop_discriminators.begin();
-        object._htop_discriminators.end() != htop;
-        ++htop)
-    {
-        _htop_discriminators.push_back(
-                dynamic_pointer_cast<Chi2Discriminator>((*htop)->clone()));
-    }
-}
+        virtual void add(const Generator &, const Generator::Hypothesis &);
+        virtual Mttbar result() const;
 
-uint32_t Chi2ResonanceReconstructor::id() const
-{
-    return core::ID<Chi2ResonanceReconstructor>::get();
-}
+    private:
+        const Chi2ResonanceReconstructor &_reconstructor;
+        const Neutrinos &_neutrinos;
 
-Chi2ResonanceReconstructor::ObjectPtr
-    Chi2ResonanceReconstructor::clone() const
-{
-    return ObjectPtr(new Chi2ResonanceReconstructor(*this));
-}
+        // ltop chi2 per leptonic jet and neutrino solution
+        //
+        std::vector<float> _ltop_chi2s;
 
-void Chi2ResonanceReconstructor::print(std::ostream &out) const
-{
-    out << "Chi2ResonanceReconstructor" << endl;
-}
+        Chi2Hypothesis _candidate;
+        Chi2Hypothesis _best_chi2_hypothesis;
+};
 
-void Chi2ResonanceReconstructor::setLtopDiscriminators(
-        const Chi2Discriminators &discriminators)
+Chi2ResonanceReconstructor::Chi2Search::Chi2Search(
+        const Chi2ResonanceReconstructor &reconstructor,
+        const LorentzVector &lepton,
+        const Neutrinos &neutrinos,
+        const Generator &generator):
+    _reconstructor(reconstructor),
+    _neutrinos(neutrinos)
 {
-    _ltop_discriminators = discriminators;
-}
+    _candidate.lepton = lepton;
 
-void Chi2ResonanceReconstructor::setHtopDiscriminators(
-        const Chi2Discriminators &discriminators)
-{
-    _htop_discriminators = discriminators;
+    // Leptonic top p4 = leptonP4 + nuP4 + bP4 depends only on the leptonic
+    // jet and neutrino solution. If none of the ltop discriminators looks
+    // at the hadronic leg, ltop chi2 is calculated once per jet and
+    // neutrino instead of once per hypothesis
+    //
+    if (!_reconstructor._is_leptonic_ltop)
+        return;
+
+    _ltop_chi2s.reserve(generator.objects() * _neutrinos.size());
+    for(uint32_t jet = 0; generator.objects() > jet; ++jet)
+    {
+        _candidate.ltop_jet = generator.object(jet).corrected_p4;
+
+        for(Neutrinos::const_iterator neutrino = _neutrinos.begin();
+                _neutrinos.end() != neutrino;
+                ++neutrino)
+        {
+            _candidate.neutrino = *neutrino;
+            _candidate.ltop = lepton + _candidate.ltop_jet;
+            _candidate.ltop += _candidate.neutrino;
+
+            float ltop_chi2 = 0;
+            _reconstructor.chi2(ltop_chi2,
+                                _reconstructor._ltop_discriminators,
+                                _candidate,
+                                numeric_limits<float>::infinity());
+
+            _ltop_chi2s.push_back(ltop_chi2);
+        }
+    }
 }
 
-Chi2ResonanceReconstructor::Mttbar Chi2ResonanceReconstructor::run(
-        const LorentzVector &lepton,
-        const LorentzVector &met,
-        const SynchSelector::GoodJets &jets) const
+void Chi2ResonanceReconstructor::Chi2Search::add(
+        const Generator &generator,
+        const Generator::Hypothesis &hypothesis)
 {
-    Mttbar result;
+    const LorentzVector &lepton = _candidate.lepton;
 
-    // Reconstruct the neutrino pZ and keep solutions in vector for later
-    // use
-    //
-    NeutrinoReconstruct neutrinoReconstruct;
-    NeutrinoReconstruct::Solutions neutrinos =
-        neutrinoReconstruct(lepton, met);
+    if (!_reconstructor.isValidHadronicSide(lepton, hypothesis.hadronic)
+            || !_reconstructor.isValidLeptonicSide(lepton, hypothesis.leptonic)
+            || !_reconstructor.isValidNeutralSide(lepton, hypothesis.neutral))
 
-    result.solutions = neutrinoReconstruct.solutions();
+            return;
 
-    for(NeutrinoReconstruct::Solutions::const_iterator neutrino =
-                neutrinos.begin();
-            neutrinos.end() != neutrino;
-            ++neutrino)
-    {
-        result.neutrinos.push_back(**neutrino);
-    }
+    const float no_bound = numeric_limits<float>::infinity();
+    const uint32_t solutions = _neutrinos.size();
 
-    // Prepare generator and loop over all hypotheses of the decay
-    // (different jets assignment to leptonic/hadronic legs)
+    Chi2Hypothesis &candidate = _candidate;
+    Chi2Hypothesis &best_chi2_hypothesis = _best_chi2_hypothesis;
+
+    // Leptonic Top p4 = leptonP4 + nuP4 + bP4
+    // where bP4 is:
+    //  - b-tagged jet
+    //  - otherwise, the hardest jet (highest pT)
     //
-    Generator generator;
-    generator.init(jets);
+    const CorrectedJet *ltop_jet =
+        _reconstructor.findLeptonicJet(hypothesis.leptonic);
+    const uint32_t ltop_jet_index = ltop_jet - &generator.object(0);
 
-    Chi2Hypothesis best_chi2_hypothesis;
+    bool is_htop_set = false;
 
-    // Loop over all possible hypotheses and pick the best one
-    // Note: take into account all reconstructed neutrino solutions
+    // Take into account all neutrino solutions
     //
-    do
+    for(uint32_t neutrino = 0; solutions > neutrino; ++neutrino)
     {
-        Generator::Hypothesis hypothesis = generator.hypothesis();
-
-        if (!isValidHadronicSide(lepton, hypothesis.hadronic)
-                || !isValidLeptonicSide(lepton, hypothesis.leptonic)
-                || !isValidNeutralSide(lepton, hypothesis.neutral))
-
-                continue;
-
-        Chi2Hypothesis chi2_hypothesis(&hypothesis);
+        ++_reconstructor._candidates;
 
-        // Leptonic Top p4 = leptonP4 + nuP4 + bP4
-        // where bP4 is:
-        //  - b-tagged jet
-        //  - otherwise, the hardest jet (highest pT)
+        // Apply ltop discriminators: chi2 is a sum of non-negative
+        // terms and candidate is abandoned as soon as the partial sum
+        // is worse than the best solution
         //
-        chi2_hypothesis.lepton = lepton;
-        chi2_hypothesis.ltop_jet =
-            getLeptonicJet(chi2_hypothesis.ltop_jets);
+        if (_reconstructor._is_leptonic_ltop)
+        {
+            candidate.ltop_chi2 =
+                _ltop_chi2s[ltop_jet_index * solutions + neutrino];
 
-        chi2_hypothesis.ltop = lepton + chi2_hypothesis.ltop_jet;
+            if (candidate.ltop_chi2 > best_chi2_hypothesis.ltop_chi2)
+            {
+                ++_reconstructor._pruned;
 
-        // the neutrino will be taken into account later
-        //
+                continue;
+            }
+        }
+
+        candidate.ltop_jet = ltop_jet->corrected_p4;
+        candidate.neutrino = _neutrinos[neutrino];
+        candidate.ltop = lepton + candidate.ltop_jet;
+        candidate.ltop += candidate.neutrino;
 
         // htop is a sum of all jet p4s assigned to the hadronic leg
         //
-        for(Generator::Iterators::const_iterator jet =
-                    chi2_hypothesis.htop_jets.begin();
-                chi2_hypothesis.htop_jets.end() != jet;
-                ++jet)
+        if (!is_htop_set)
         {
-            chi2_hypothesis.htop += *(*jet)->corrected_p4;
+            candidate.index = generator.index();
+            candidate.htop = generator.p4(Generator::HADRONIC);
+            candidate.htop_jets = hypothesis.hadronic;
+
+            is_htop_set = true;
         }
 
-        // Take into account all neutrino solutions. Solutions are kept in
-        // a vector of pointer
-        //
-        for(NeutrinoReconstruct::Solutions::const_iterator neutrino =
-                    neutrinos.begin();
-                neutrinos.end() != neutrino;
-                ++neutrino)
+        if (!_reconstructor._is_leptonic_ltop)
         {
-            Chi2Hypothesis chi2_hypothesis_tmp = chi2_hypothesis;
-            chi2_hypothesis_tmp.neutrino = *(*neutrino);
-            chi2_hypothesis_tmp.ltop += chi2_hypothesis_tmp.neutrino;
-
-            // Apply ltop discriminators
-            chi2_hypothesis_tmp.ltop_chi2 = 0;
-            for(Chi2Discriminators::const_iterator discriminator =
-                        _ltop_discriminators.begin();
-                    _ltop_discriminators.end() != discriminator;
-                    ++discriminator)
+            _reconstructor.chi2(candidate.ltop_chi2,
+                                _reconstructor._ltop_discriminators,
+                                candidate,
+                                best_chi2_hypothesis.ltop_chi2);
+
+            if (candidate.ltop_chi2 > best_chi2_hypothesis.ltop_chi2)
             {
-                chi2_hypothesis_tmp.ltop_chi2 +=
-                    (*discriminator)->calculate(chi2_hypothesis_tmp);
-            }
+                ++_reconstructor._pruned;
 
-            if (chi2_hypothesis_tmp.ltop_chi2 > best_chi2_hypothesis.ltop_chi2)
                 continue;
-
-            // Apply htop discriminators
-            chi2_hypothesis_tmp.htop_chi2 = 0;
-            for(Chi2Discriminators::const_iterator discriminator =
-                        _htop_discriminators.begin();
-                    _htop_discriminators.end() != discriminator;
-                    ++discriminator)
-            {
-                chi2_hypothesis_tmp.htop_chi2 +=
-                    (*discriminator)->calculate(chi2_hypothesis_tmp);
             }
+        }
 
-            if (chi2_hypothesis_tmp.ltop_chi2 == best_chi2_hypothesis.ltop_chi2
-                    && chi2_hypothesis_tmp.htop_chi2 > best_chi2_hypothesis.htop_chi2)
-                continue;
+        // Apply htop discriminators: the bound is only used if ltop
+        // chi2 is the same as in the best solution
+        //
+        const bool is_ltop_tie =
+            candidate.ltop_chi2 == best_chi2_hypothesis.ltop_chi2;
+
+        if (!_reconstructor.chi2(candidate.htop_chi2,
+                                 _reconstructor._htop_discriminators,
+                                 candidate,
+                                 is_ltop_tie
+                                    ? best_chi2_hypothesis.htop_chi2
+                                    : no_bound))
+        {
+            ++_reconstructor._pruned;
 
-            best_chi2_hypothesis = chi2_hypothesis_tmp;
-            best_chi2_hypothesis.valid = true;
+            continue;
         }
+
+        if (is_ltop_tie
+                && candidate.htop_chi2 > best_chi2_hypothesis.htop_chi2)
+            continue;
+
+        // Hypotheses are not generated in the index order: equal
+        // solutions are resolved in favour of the larger index
+        //
+        if (is_ltop_tie
+                && candidate.htop_chi2 == best_chi2_hypothesis.htop_chi2
+                && best_chi2_hypothesis.valid
+                && candidate.index < best_chi2_hypothesis.index)
+            continue;
+
+        best_chi2_hypothesis = candidate;
+        best_chi2_hypothesis.ltop_jets = hypothesis.leptonic;
+        best_chi2_hypothesis.valid = true;
     }
-    while(generator.next());
+}
+
+Chi2ResonanceReconstructor::Mttbar
+    Chi2ResonanceReconstructor::Chi2Search::result() const
+{
+    Mttbar result;
 
     // Best Solution is found
     //
+    const Chi2Hypothesis &best_chi2_hypothesis = _best_chi2_hypothesis;
     if (best_chi2_hypothesis.valid)
     {
         result.mttbar = best_chi2_hypothesis.ltop + best_chi2_hypothesis.htop;
@@ -1529,3 +1729,149 @@ Chi2ResonanceReconstructor::Mttbar Chi2ResonanceReconstructor::run(
 
     return result;
 }
+
+Chi2ResonanceReconstructor::Chi2ResonanceReconstructor():
+    _is_leptonic_ltop(true),
+    _candidates(0),
+    _pruned(0)
+{
+}
+
+Chi2ResonanceReconstructor::Chi2ResonanceReconstructor(
+        const Chi2ResonanceReconstructor &object):
+    SimpleResonanceReconstructor(object),
+    _is_leptonic_ltop(object._is_leptonic_ltop),
+    _candidates(0),
+    _pruned(0)
+{
+    for(Chi2Discriminators::const_iterator ltop =
+            object._ltop_discriminators.begin();
+        object._ltop_discriminators.end() != ltop;
+        ++ltop)
+    {
+        _ltop_discriminators.push_back(
+                dynamic_pointer_cast<Chi2Discriminator>((*ltop)->clone()));
+    }
+
+    for(Chi2Discriminators::const_iterator htop =
+            object._htop_discriminators.begin();
+        object._htop_discriminators.end() != htop;
+        ++htop)
+    {
+        _htop_discriminators.push_back(
+                dynamic_pointer_cast<Chi2Discriminator>((*htop)->clone()));
+    }
+}
+
+uint32_t Chi2ResonanceReconstructor::id() const
+{
+    return core::ID<Chi2ResonanceReconstructor>::get();
+}
+
+Chi2ResonanceReconstructor::ObjectPtr
+    Chi2ResonanceReconstructor::clone() const
+{
+    return ObjectPtr(new Chi2ResonanceReconstructor(*this));
+}
+
+void Chi2ResonanceReconstructor::merge(const ObjectPtr &pointer)
+{
+    if (pointer->id() != id())
+        return;
+
+    boost::shared_ptr<Chi2ResonanceReconstructor> object =
+        dynamic_pointer_cast<Chi2ResonanceReconstructor>(pointer);
+
+    if (!object)
+        return;
+
+    _candidates += object->_candidates;
+    _pruned += object->_pruned;
+}
+
+void Chi2ResonanceReconstructor::print(std::ostream &out) const
+{
+    out << "Chi2ResonanceReconstructor" << endl;
+    out << " candidates: " << _candidates
+        << " pruned: " << _pruned << endl;
+}
+
+void Chi2ResonanceReconstructor::setLtopDiscriminators(
+        const Chi2Discriminators &discriminators)
+{
+    _ltop_discriminators = discriminators;
+    stable_sort(_ltop_discriminators.begin(), _ltop_discriminators.end(),
+            isCheaper);
+
+    _is_leptonic_ltop = true;
+    for(Chi2Discriminators::const_iterator discriminator =
+                _ltop_discriminators.begin();
+            _ltop_discriminators.end() != discriminator;
+            ++discriminator)
+    {
+        if (!(*discriminator)->isLeptonic())
+        {
+            _is_leptonic_ltop = false;
+
+            break;
+        }
+    }
+}
+
+void Chi2ResonanceReconstructor::setHtopDiscriminators(
+        const Chi2Discriminators &discriminators)
+{
+    _htop_discriminators = discriminators;
+    stable_sort(_htop_discriminators.begin(), _htop_discriminators.end(),
+            isCheaper);
+}
+
+uint64_t Chi2ResonanceReconstructor::candidates() const
+{
+    return _candidates;
+}
+
+uint64_t Chi2ResonanceReconstructor::pruned() const
+{
+    return _pruned;
+}
+
+Chi2ResonanceReconstructor::SearchPtr Chi2ResonanceReconstructor::search(
+        const LorentzVector &lepton,
+        const Neutrinos &neutrinos,
+        const Generator &generator) const
+{
+    return SearchPtr(new Chi2Search(*this, lepton, neutrinos, generator));
+}
+
+// Private
+//
+bool Chi2ResonanceReconstructor::chi2(float &chi2,
+        const Chi2Discriminators &discriminators,
+        const Chi2Hypothesis &hypothesis,
+        const float &bound) const
+{
+    chi2 = 0;
+    for(Chi2Discriminators::const_iterator discriminator =
+                discriminators.begin();
+            discriminators.end() != discriminator;
+            ++discriminator)
+    {
+        chi2 += (*discriminator)->calculate(hypothesis);
+
+        // Terms are non-negative: partial sum can only grow
+        //
+        if (chi2 > bound
+                && discriminators.end() != discriminator + 1)
+
+            return false;
+    }
+
+    return true;
+}
+
+bool Chi2ResonanceReconstructor::isCheaper(const Chi2DiscriminatorPtr &left,
+        const Chi2DiscriminatorPtr &right)
+{
+    return left->cost() < right->cost();
+}
@@ -20,6 +20,7 @@
 #include "bsm_input/interface/Event.pb.h"
 #include "interface/Analyzer.h"
 #include "interface/AppController.h"
+#include "interface/OutputRegistry.h"
 #include "interface/Thread.h"
 #include "interface/Utility.h"
 
@@ -36,7 +37,8 @@ AppController::AppController():
     _run_mode(SINGLE_THREAD),
     _disable_multithread(false),
     _number_of_threads(0),
-    _interactive(false)
+    _interactive(false),
+    _snapshot_interval(0)
 {
     // Generic Options: common to all executables
     //
@@ -64,6 +66,13 @@ AppController::AppController():
          po::value<string>()->notifier(
              boost::bind(&AppController::setOutput, this, _1)),
          "save output plots in file")
+
+        ("snapshot",
+         po::value<uint32_t>()->notifier(
+             boost::bind(&AppController::setSnapshotInterval, this, _1)),
+         "save merged output plots every N seconds in multi-thread mode; "
+         "requires --output, the snapshot of out.root is written to "
+         "out.snapshot.root")
     ;
 
     // Hidden options: necessary for the positional arguments
@@ -243,6 +252,8 @@ bool AppController::run(int &argc, char *argv[])
             _output.reset(new TFile(_output_filename.c_str(), "RECREATE"));
             if (!_output->IsOpen())
                 _output.reset();
+            else if (_analyzer->outputs())
+                _analyzer->outputs()->write(_output.get());
         }
     }
 
@@ -310,6 +321,11 @@ void AppController::setOutput(const string &filename)
     _output_filename = filename;
 }
 
+void AppController::setSnapshotInterval(const uint32_t &interval)
+{
+    _snapshot_interval = interval;
+}
+
 void AppController::processSingleThread()
 {
     shared_ptr<Summary> _summary(new Summary(_input_files.size()));
@@ -356,6 +372,20 @@ void AppController::processMultiThread()
         controller->push(*input);
     }
 
+    // Snapshot is saved next to the output: out.root -> out.snapshot.root
+    //
+    if (_snapshot_interval
+            && !_output_filename.empty())
+    {
+        fs::path snapshot_file(_output_filename);
+        snapshot_file.replace_extension(".snapshot.root");
+
+        controller->setSnapshot(_snapshot_interval, snapshot_file.string());
+    }
+    else if (_snapshot_interval)
+        cerr << "snapshot requires output file: snapshots are not saved"
+            << endl;
+
     controller->use(_analyzer, isAnalyzerReaderDelegate());
     controller->start();
 }
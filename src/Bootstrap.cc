@@ -0,0 +1,251 @@
+// Poisson bootstrap
+//
+// Every event enters N replicas of the selected histograms with independent
+// Poisson(1) weights. Weights are drawn from the seed built out of the
+// event run, lumi and id: the same event always gets the same weights
+// independently of the thread, job splitting or order of events
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <ostream>
+
+#include <boost/pointer_cast.hpp>
+
+#include "bsm_core/interface/ID.h"
+#include "interface/Bootstrap.h"
+
+using namespace std;
+
+using bsm::Bootstrap;
+using bsm::BootstrapH1;
+
+namespace
+{
+    // SplitMix64 finalizer: consecutive states give independent values
+    //
+    uint64_t mix(uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+
+        return value ^ (value >> 31);
+    }
+
+    // Cumulative Poisson(1) probabilities. Weights above the table size
+    // have probability below 1e-10 and are truncated
+    //
+    struct PoissonTable
+    {
+        enum
+        {
+            SIZE = 14
+        };
+
+        PoissonTable()
+        {
+            double probability = exp(-1.0);
+            double sum = 0;
+            for(uint32_t k = 0; SIZE > k; ++k)
+            {
+                if (k)
+                    probability /= k;
+
+                sum += probability;
+                cdf[k] = sum;
+            }
+        }
+
+        uint8_t draw(const uint64_t &random) const
+        {
+            const double uniform = (random >> 11) * (1.0 / 9007199254740992.0);
+
+            uint8_t k = 0;
+            while(SIZE - 1 > k
+                    && uniform >= cdf[k])
+                ++k;
+
+            return k;
+        }
+
+        double cdf[SIZE];
+    };
+
+    const PoissonTable poisson;
+}
+
+// Bootstrap
+//
+Bootstrap::Bootstrap(const uint32_t &replicas):
+    _replicas(replicas),
+    _weights(replicas, 1)
+{
+}
+
+bool Bootstrap::isEnabled() const
+{
+    return 0 < _replicas;
+}
+
+uint32_t Bootstrap::replicas() const
+{
+    return _replicas;
+}
+
+void Bootstrap::setEvent(const uint32_t &run,
+        const uint32_t &lumi,
+        const uint32_t &event)
+{
+    uint64_t state = mix(mix((static_cast<uint64_t>(run) << 32) | lumi)
+                         ^ event);
+
+    for(Weights::iterator weight = _weights.begin();
+            _weights.end() != weight;
+            ++weight)
+    {
+        state += 0x9e3779b97f4a7c15ULL;
+
+        *weight = poisson.draw(mix(state));
+    }
+}
+
+const Bootstrap::Weights &Bootstrap::weights() const
+{
+    return _weights;
+}
+
+
+
+// Bootstrap H1
+//
+BootstrapH1::BootstrapH1(const uint32_t &replicas,
+        const uint32_t &bins,
+        const float &min,
+        const float &max):
+    _replicas(replicas),
+    _bins(bins),
+    _min(min),
+    _max(max)
+{
+}
+
+void BootstrapH1::fill(const Bootstrap &bootstrap,
+        const double &x,
+        const double &weight)
+{
+    if (bootstrap.replicas() != _replicas
+            || !_replicas)
+        return;
+
+    // Contents are allocated with the first fill: threads that do not
+    // select any event do not hold the replicas
+    //
+    if (_contents.empty())
+        _contents.resize((_bins + 2) * _replicas, 0);
+
+    Contents::iterator content = _contents.begin() + bin(x) * _replicas;
+    for(Bootstrap::Weights::const_iterator replica_weight =
+                bootstrap.weights().begin();
+            bootstrap.weights().end() != replica_weight;
+            ++replica_weight, ++content)
+    {
+        *content += weight * *replica_weight;
+    }
+}
+
+uint32_t BootstrapH1::replicas() const
+{
+    return _replicas;
+}
+
+uint32_t BootstrapH1::bins() const
+{
+    return _bins;
+}
+
+float BootstrapH1::min() const
+{
+    return _min;
+}
+
+float BootstrapH1::max() const
+{
+    return _max;
+}
+
+double BootstrapH1::content(const uint32_t &replica,
+        const uint32_t &bin) const
+{
+    if (_contents.empty()
+            || _replicas <= replica
+            || _bins + 1 < bin)
+        return 0;
+
+    return _contents[bin * _replicas + replica];
+}
+
+uint32_t BootstrapH1::id() const
+{
+    return core::ID<BootstrapH1>::get();
+}
+
+BootstrapH1::ObjectPtr BootstrapH1::clone() const
+{
+    return ObjectPtr(new BootstrapH1(*this));
+}
+
+void BootstrapH1::merge(const ObjectPtr &pointer)
+{
+    if (id() != pointer->id())
+        return;
+
+    boost::shared_ptr<BootstrapH1> object =
+        boost::dynamic_pointer_cast<BootstrapH1>(pointer);
+
+    if (!object
+            || object->_contents.empty())
+        return;
+
+    if (_replicas != object->_replicas
+            || _bins != object->_bins
+            || _min != object->_min
+            || _max != object->_max)
+        return;
+
+    if (_contents.empty())
+    {
+        _contents = object->_contents;
+
+        return;
+    }
+
+    transform(_contents.begin(), _contents.end(),
+              object->_contents.begin(),
+              _contents.begin(),
+              plus<double>());
+}
+
+void BootstrapH1::print(std::ostream &out) const
+{
+    out << "Bootstrap: " << _replicas << " replicas of "
+        << _bins << " bins [" << _min << ".." << _max << "]";
+}
+
+// Private
+//
+uint32_t BootstrapH1::bin(const double &x) const
+{
+    if (x < _min)
+        return 0;
+
+    if (x >= _max)
+        return _bins + 1;
+
+    return 1 + std::min<uint32_t>(_bins - 1,
+                                  static_cast<uint32_t>((x - _min)
+                                                        / (_max - _min)
+                                                        * _bins));
+}
@@ -76,27 +76,15 @@ void BtagOptions::setMistagSystematic(const BtagDelegate::Systematic &systematic
 //
 BtagFunction::BtagFunction()
 {
+    // Bins are (low, high]: jets outside of the range use the first or
+    // last bin
+    //
     const float bins[] = {
         30, 40, 50, 60, 70, 80, 100, 120, 160, 210, 260, 320, 400, 500, 670
     };
 
-    _bins.assign(bins, bins + 15);
-}
-
-const uint32_t BtagFunction::find_bin(const float &jet_pt) const
-{
-    if (jet_pt < _bins.front())
-        return 0;
-
-    if (jet_pt > _bins.back())
-        return _bins.size() - 2;
-
-    uint32_t bin = 0;
-    for(vector<float>::const_iterator bin_pt = _bins.begin();
-            _bins.end() != ++bin_pt && *bin_pt < jet_pt;
-            ++bin);
-
-    return bin;
+    _table = LookupTable(LookupAxis(vector<float>(bins, bins + 15),
+                LookupAxis::UPPER_INCLUSIVE));
 }
 
 
@@ -110,7 +98,7 @@ BtagScale::BtagScale()
         0.0777011, 0.0866563
     };
 
-    _errors.assign(errors, errors + 14);
+    _table.set(LookupTable::NOMINAL, vector<float>(errors, errors + 14));
 }
 
 float BtagScale::value(const float &jet_pt) const
@@ -138,7 +126,7 @@ float BtagScale::error(const float &jet_pt) const
     if (670 <= jet_pt)
         return 2 * error(669);
 
-    return _errors.at(find_bin(jet_pt));
+    return _table.value(jet_pt);
 }
 
 
@@ -208,12 +196,12 @@ BtagEfficiency::BtagEfficiency()
         0.271581953854, 0.224112593547, 0.11042330955, 0.123300043702
     };
 
-    _values.assign(values, values + 14);
+    _table.set(LookupTable::NOMINAL, vector<float>(values, values + 14));
 }
 
 float BtagEfficiency::value(const float &jet_pt) const
 {
-    return _values.at(find_bin(jet_pt));
+    return _table.value(jet_pt);
 }
 
 
@@ -229,12 +217,7 @@ LightEfficiency::LightEfficiency()
         0.01859141652
     };
 
-    _values.assign(values, values + 14);
-}
-
-float LightEfficiency::value(const float &jet_pt) const
-{
-    return _values.at(find_bin(jet_pt));
+    _table.set(LookupTable::NOMINAL, vector<float>(values, values + 14));
 }
 
 
@@ -291,53 +274,44 @@ Btag::Btag(const Btag &object):
 
 Btag::Info Btag::is_tagged(const CorrectedJet &jet)
 {
-    typedef ::google::protobuf::RepeatedPtrField<Jet::BTag> BTags;
+    if (!jet.has_csv)
+        return make_pair(false, 1);
+
+    bool result = _discriminator < jet.csv;
+    float scale_ = 1;
 
-    for(BTags::const_iterator btag = jet.jet->btag().begin();
-            jet.jet->btag().end() != btag;
-            ++btag)
+    if (jet.jet->has_gen_parton())
     {
-        if (Jet::BTag::CSV == btag->type())
+        const float jet_pt = jet.corrected_pt;
+        switch(abs(jet.jet->gen_parton().id()))
         {
-            bool result = _discriminator < btag->discriminator();
-            float scale_ = 1;
-
-            if (jet.jet->has_gen_parton())
-            {
-                const float jet_pt = pt(*jet.corrected_p4);
-                switch(abs(jet.jet->gen_parton().id()))
-                {
-                    case 5: // b-quark
-                        scale_ = scale(result, jet_pt,
-                                       _scale_btag, _eff_btag,
-                                       _btag_systematic);
-                        break;
-
-                    case 4: // c-quark
-                        scale_ = scale(result, jet_pt,
-                                       _scale_ctag, _eff_ctag,
-                                       _btag_systematic);
-                        break;
-
-                    case 3: // s-quark
-                    case 2: // d-quark
-                    case 1: // u-quark
-                    case 21: // gluon
-                        scale_ = scale_data(result, jet_pt,
-                                            _scale_light, _eff_light,
-                                            _mistag_systematic);
-                        break;
-
-                    default:
-                        break;
-                }
-            }
-
-            return make_pair(result, scale_);
+            case 5: // b-quark
+                scale_ = scale(result, jet_pt,
+                               _scale_btag, _eff_btag,
+                               _btag_systematic);
+                break;
+
+            case 4: // c-quark
+                scale_ = scale(result, jet_pt,
+                               _scale_ctag, _eff_ctag,
+                               _btag_systematic);
+                break;
+
+            case 3: // s-quark
+            case 2: // d-quark
+            case 1: // u-quark
+            case 21: // gluon
+                scale_ = scale_data(result, jet_pt,
+                                    _scale_light, _eff_light,
+                                    _mistag_systematic);
+                break;
+
+            default:
+                break;
         }
     }
 
-    return make_pair(false, 1);
+    return make_pair(result, scale_);
 }
 
 // BtagDelegate interface
@@ -34,9 +34,11 @@ BtagEfficiencyAnalyzer::BtagEfficiencyAnalyzer():
 
     _parton_jets.reset(new H2Proxy(25, 0, 25, 67, 0, 670));
     monitor(_parton_jets);
+    _outputs.add("parton_jets", _parton_jets);
 
     _btagged_parton_jets.reset(new H2Proxy(25, 0, 25, 67, 0, 670));
     monitor(_btagged_parton_jets);
+    _outputs.add("btagged_parton_jets", _btagged_parton_jets);
 
     _btag.reset(new Btag());
     monitor(_btag);
@@ -56,10 +58,12 @@ BtagEfficiencyAnalyzer::BtagEfficiencyAnalyzer(
 
     _parton_jets = dynamic_pointer_cast<H2Proxy>(object._parton_jets->clone());
     monitor(_parton_jets);
+    _outputs.add("parton_jets", _parton_jets);
 
     _btagged_parton_jets =
         dynamic_pointer_cast<H2Proxy>(object._btagged_parton_jets->clone());
     monitor(_btagged_parton_jets);
+    _outputs.add("btagged_parton_jets", _btagged_parton_jets);
 
     _btag.reset(new Btag());
     monitor(_btag);
@@ -105,6 +109,11 @@ const stat::H2Ptr BtagEfficiencyAnalyzer::btagged_parton_jets() const
     return _btagged_parton_jets->histogram();
 }
 
+const bsm::OutputRegistry *BtagEfficiencyAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 // Processing
 //
 void BtagEfficiencyAnalyzer::onFileOpen(const string &filename,
@@ -140,12 +149,12 @@ void BtagEfficiencyAnalyzer::process(const Event *event)
                 if ((0 < pdg_id && 6 > pdg_id) || 21 == pdg_id)
                 {
                     parton_jets()->fill(pdg_id,
-                                        pt(*jet->corrected_p4),
+                                        jet->corrected_pt,
                                         _pileup_weight);
 
                     if (_btag->is_tagged(*jet).first)
                         btagged_parton_jets()->fill(pdg_id,
-                                                    pt(*jet->corrected_p4),
+                                                    jet->corrected_pt,
                                                     _pileup_weight);
                 }
             }
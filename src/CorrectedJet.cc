@@ -0,0 +1,61 @@
+// Corrected jet structure: reference to the original jet, subtracted leptons,
+// p4 after subtractions and corrected p4.
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include "bsm_input/interface/Algebra.h"
+#include "bsm_input/interface/Jet.pb.h"
+
+#include "interface/CorrectedJet.h"
+
+using namespace bsm;
+
+void CorrectedJet::reset(const Jet *jet_)
+{
+    jet = jet_;
+
+    corrected_p4.CopyFrom(jet->uncorrected_p4());
+    corrected_met.Clear();
+    subtracted_p4.Clear();
+
+    subtracted_electrons.clear();
+    subtracted_muons.clear();
+
+    correction = 0;
+
+    has_csv = false;
+    csv = 0;
+
+    has_ssvhe = false;
+    ssvhe = 0;
+
+    typedef ::google::protobuf::RepeatedPtrField<Jet::BTag> BTags;
+
+    for(BTags::const_iterator btag = jet->btag().begin();
+            jet->btag().end() != btag;
+            ++btag)
+    {
+        if (Jet::BTag::CSV == btag->type()
+                && !has_csv)
+        {
+            has_csv = true;
+            csv = btag->discriminator();
+        }
+        else if (Jet::BTag::SSVHE == btag->type()
+                && !has_ssvhe)
+        {
+            has_ssvhe = true;
+            ssvhe = btag->discriminator();
+        }
+    }
+
+    update();
+}
+
+void CorrectedJet::update()
+{
+    corrected_pt = pt(corrected_p4);
+    corrected_eta = eta(corrected_p4);
+    corrected_phi = phi(corrected_p4);
+}
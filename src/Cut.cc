@@ -23,6 +23,9 @@ using bsm::LockCounterOnUpdate;
 //
 Counter::Counter():
     _counts(0),
+    _sum_of_weights(0),
+    _sum_of_weights2(0),
+    _weight(1),
     _is_locked(false),
     _is_lock_on_update(false)
 {
@@ -31,6 +34,9 @@ Counter::Counter():
 
 Counter::Counter(const Counter &counter):
     _counts(counter._counts),
+    _sum_of_weights(counter._sum_of_weights),
+    _sum_of_weights2(counter._sum_of_weights2),
+    _weight(counter._weight),
     _is_locked(false),
     _is_lock_on_update(false)
 {
@@ -50,16 +56,36 @@ bsm::CounterDelegate *Counter::delegate() const
 
 // Obsolete method: use explicit counts instead
 //
-Counter::operator uint32_t() const
+Counter::operator uint64_t() const
 {
     return _counts;
 }
 
-uint32_t Counter::counts() const
+uint64_t Counter::counts() const
 {
     return _counts;
 }
 
+double Counter::sumOfWeights() const
+{
+    return _sum_of_weights;
+}
+
+double Counter::sumOfWeights2() const
+{
+    return _sum_of_weights2;
+}
+
+double Counter::weight() const
+{
+    return _weight;
+}
+
+void Counter::setWeight(const double &weight)
+{
+    _weight = weight;
+}
+
 bool Counter::isLocked() const
 {
     return _is_locked;
@@ -86,12 +112,14 @@ void Counter::unlock()
     _is_lock_on_update = false;
 }
 
-void Counter::add(const uint32_t &counts)
+void Counter::add(const uint64_t &counts)
 {
     if (isLocked())
         return;
 
     _counts += counts;
+    _sum_of_weights += counts * _weight;
+    _sum_of_weights2 += counts * _weight * _weight;
 
     if (isLockOnUpdate())
     {
@@ -122,10 +150,16 @@ void Counter::merge(const ObjectPtr &pointer)
     boost::shared_ptr<Counter> object =
         boost::dynamic_pointer_cast<Counter>(pointer);
 
-    if (!object)
+    if (!object
+            || isLocked())
         return;
 
-    add(object->counts());
+    // Sums are added directly: current weight should not be applied and
+    // delegate is not notified about merge
+    //
+    _counts += object->_counts;
+    _sum_of_weights += object->_sum_of_weights;
+    _sum_of_weights2 += object->_sum_of_weights2;
 }
 
 void Counter::print(ostream &out) const
@@ -224,6 +258,47 @@ bool Cut::apply(const float &value)
     return true;
 }
 
+uint32_t Cut::apply(const CutValues &values, SelectionMask &mask)
+{
+    const uint32_t size = mask.size();
+
+    uint32_t passed = 0;
+    if (isDisabled()
+            || !size)
+    {
+        for(uint32_t i = 0; size > i; ++i)
+            passed += mask[i];
+
+        return passed;
+    }
+
+    _pass.resize(size);
+    isPassArray(&values[0], size, &_pass[0]);
+
+    // Inverted cut keeps values that fail the cut
+    //
+    const uint8_t inverted = isInverted();
+    for(uint32_t i = 0; size > i; ++i)
+    {
+        mask[i] &= _pass[i] ^ inverted;
+        passed += mask[i];
+    }
+
+    if (passed)
+    {
+        objects()->add(passed);
+        events()->add();
+    }
+
+    return passed;
+}
+
+void Cut::setWeight(const double &weight)
+{
+    objects()->setWeight(weight);
+    events()->setWeight(weight);
+}
+
 void Cut::disable()
 {
     _is_disabled = true;
@@ -288,6 +363,18 @@ void Cut::print(ostream &out) const
 
 
 
+// Private
+//
+void Cut::isPassArray(const float *values,
+        const uint32_t &size,
+        uint8_t *result)
+{
+    for(uint32_t i = 0; size > i; ++i)
+        result[i] = isPass(values[i]);
+}
+
+
+
 // Lock counter on update
 //
 LockCounterOnUpdate::LockCounterOnUpdate(const CounterPtr &counter):
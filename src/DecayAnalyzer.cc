@@ -24,6 +24,7 @@ using namespace std;
 using boost::dynamic_pointer_cast;
 
 using bsm::DecayAnalyzer;
+using bsm::GenDecay;
 
 DecayAnalyzer::DecayAnalyzer()
 {
@@ -38,6 +39,8 @@ DecayAnalyzer::DecayAnalyzer()
     monitor(_decay_level_3);
     monitor(_decay_level_4);
     monitor(_decay_level_5);
+
+    registerOutputs();
 }
 
 DecayAnalyzer::DecayAnalyzer(const DecayAnalyzer &object)
@@ -53,6 +56,8 @@ DecayAnalyzer::DecayAnalyzer(const DecayAnalyzer &object)
     monitor(_decay_level_3);
     monitor(_decay_level_4);
     monitor(_decay_level_5);
+
+    registerOutputs();
 }
 
 void DecayAnalyzer::onFileOpen(const std::string &filename, const Input *)
@@ -64,7 +69,45 @@ void DecayAnalyzer::process(const Event *event)
     if (!event->gen_particle().size())
         return;
 
-    genParticles(event->gen_particle());
+    _gen_decay.fill(event);
+
+    // Decay chains are followed through status 3 particles only
+    //
+    for(uint32_t particle = 0; _gen_decay.size() > particle; ++particle)
+    {
+        if (!_gen_decay.is(particle, GenDecay::HARD))
+            continue;
+
+        H2Ptr histogram;
+        switch(_gen_decay.level(particle))
+        {
+            case 1:
+                histogram = decay_level_1();
+                break;
+
+            case 2:
+                histogram = decay_level_2();
+                break;
+
+            case 3:
+                histogram = decay_level_3();
+                break;
+
+            case 4:
+                histogram = decay_level_4();
+                break;
+
+            case 5:
+                histogram = decay_level_5();
+                break;
+
+            default:
+                continue;
+        }
+
+        histogram->fill(_gen_decay.id(particle),
+                        _gen_decay.id(_gen_decay.parent(particle)));
+    }
 }
 
 const bsm::H2Ptr DecayAnalyzer::decay_level_1() const
@@ -92,6 +135,11 @@ const bsm::H2Ptr DecayAnalyzer::decay_level_5() const
     return _decay_level_5->histogram();
 }
 
+const bsm::OutputRegistry *DecayAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 uint32_t DecayAnalyzer::id() const
 {
     return core::ID<DecayAnalyzer>::get();
@@ -111,54 +159,13 @@ void DecayAnalyzer::print(std::ostream &out) const
     out << setw(15) << left << " [Decay L5]" << *decay_level_5();
 }
 
-// Privates
+// Private
 //
-void DecayAnalyzer::genParticles(const GenParticles &particles,
-        const GenParticle *parent,
-        const uint32_t &level)
+void DecayAnalyzer::registerOutputs()
 {
-    for(GenParticles::const_iterator particle = particles.begin();
-            particles.end() != particle;
-            ++particle)
-    {
-        // Skip unstable particles
-        //
-        if (3 != particle->status())
-            continue;
-
-        if (parent)
-        {
-            H2Ptr histogram;
-            switch(level)
-            {
-                case 1:
-                    histogram = decay_level_1();
-                    break;
-
-                case 2:
-                    histogram = decay_level_2();
-                    break;
-
-                case 3:
-                    histogram = decay_level_3();
-                    break;
-
-                case 4:
-                    histogram = decay_level_4();
-                    break;
-
-                case 5:
-                    histogram = decay_level_5();
-                    break;
-
-                default:
-                    continue;
-            }
-
-            histogram->fill(particle->id(), parent->id());
-        }
-
-        if (level < 5)
-            genParticles(particle->child(), &*particle, level + 1);
-    }
+    _outputs.add("decay_level_1", _decay_level_1, "Particle", "Parent");
+    _outputs.add("decay_level_2", _decay_level_2, "Particle", "Parent");
+    _outputs.add("decay_level_3", _decay_level_3, "Particle", "Parent");
+    _outputs.add("decay_level_4", _decay_level_4, "Particle", "Parent");
+    _outputs.add("decay_level_5", _decay_level_5, "Particle", "Parent");
 }
@@ -77,12 +77,12 @@ void EfficiencyAnalyzer::print(std::ostream &out) const
 
     SynchSelector::CutflowPtr cutflow = _synch_selector->cutflow();
 
-    const uint32_t good_leptons =
-        *(cutflow->cut(SynchSelector::HTLEP)->objects());
+    const uint64_t good_leptons =
+        cutflow->cut(SynchSelector::HTLEP)->objects()->counts();
 
     out << _synch_selector->cutMode() << " Efficiency: "
         << (good_leptons
-            ? (1.0 * *(cutflow->cut(SynchSelector::CUT_LEPTON)->objects()))
+            ? (1.0 * cutflow->cut(SynchSelector::CUT_LEPTON)->objects()->counts())
                 / good_leptons
             : 0)
         << endl;
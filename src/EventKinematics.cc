@@ -0,0 +1,222 @@
+// Per-event kinematics cache
+//
+// pt, eta and phi of the selected leptons, jets and MET are calculated once
+// per event and kept as structure-of-arrays. Lepton-jet distances are
+// calculated in one batch for all pairs on the first request
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <cmath>
+
+#include "bsm_input/interface/Algebra.h"
+#include "bsm_input/interface/Physics.pb.h"
+#include "interface/EventKinematics.h"
+
+using namespace std;
+using namespace bsm;
+
+// Kinematics Arrays
+//
+void KinematicsArrays::clear()
+{
+    pt.clear();
+    eta.clear();
+    phi.clear();
+}
+
+void KinematicsArrays::push_back(const LorentzVector &p4)
+{
+    pt.push_back(bsm::pt(p4));
+    eta.push_back(bsm::eta(p4));
+    phi.push_back(bsm::phi(p4));
+}
+
+void KinematicsArrays::push_back(const CorrectedJet &jet)
+{
+    pt.push_back(jet.corrected_pt);
+    eta.push_back(jet.corrected_eta);
+    phi.push_back(jet.corrected_phi);
+}
+
+
+
+// Kernels
+//
+void bsm::deltaR(CutValues &matrix,
+        const KinematicsArrays &rows,
+        const KinematicsArrays &columns)
+{
+    const uint32_t size = columns.size();
+
+    matrix.resize(rows.size() * size);
+    if (matrix.empty())
+        return;
+
+    const float pi = M_PI;
+    const float two_pi = 2 * M_PI;
+
+    const float *eta = &columns.eta[0];
+    const float *phi = &columns.phi[0];
+
+    for(uint32_t row = 0; rows.size() > row; ++row)
+    {
+        const float row_eta = rows.eta[row];
+        const float row_phi = rows.phi[row];
+
+        float *result = &matrix[row * size];
+
+        // phi is in [-pi, pi]: one correction brings dphi into the range
+        //
+        for(uint32_t column = 0; size > column; ++column)
+        {
+            const float deta = row_eta - eta[column];
+
+            float dphi = row_phi - phi[column];
+            dphi = dphi > pi ? dphi - two_pi : dphi;
+            dphi = dphi < -pi ? dphi + two_pi : dphi;
+
+            result[column] = sqrt(deta * deta + dphi * dphi);
+        }
+    }
+}
+
+
+
+// Event Kinematics
+//
+EventKinematics::EventKinematics()
+{
+    clear();
+}
+
+void EventKinematics::clear()
+{
+    _leptons.clear();
+
+    for(int collection = 0; JET_COLLECTIONS > collection; ++collection)
+    {
+        _jets[collection].clear();
+        _is_dr_valid[collection] = false;
+    }
+
+    _has_met = false;
+    _met_pt = 0;
+    _met_phi = 0;
+}
+
+void EventKinematics::fill(const Leptons &leptons,
+        const Jets &nice_jets,
+        const Jets &good_jets,
+        const LorentzVector *met)
+{
+    clear();
+
+    for(Leptons::const_iterator lepton = leptons.begin();
+            leptons.end() != lepton;
+            ++lepton)
+    {
+        _leptons.push_back(**lepton);
+    }
+
+    for(Jets::const_iterator jet = nice_jets.begin();
+            nice_jets.end() != jet;
+            ++jet)
+    {
+        _jets[NICE_JETS].push_back(*jet);
+    }
+
+    for(Jets::const_iterator jet = good_jets.begin();
+            good_jets.end() != jet;
+            ++jet)
+    {
+        _jets[GOOD_JETS].push_back(*jet);
+    }
+
+    if (met)
+    {
+        _has_met = true;
+        _met_pt = pt(*met);
+        _met_phi = phi(*met);
+    }
+}
+
+const KinematicsArrays &EventKinematics::leptons() const
+{
+    return _leptons;
+}
+
+const KinematicsArrays &EventKinematics::jets(
+        const JetCollection &collection) const
+{
+    return _jets[collection];
+}
+
+bool EventKinematics::hasMET() const
+{
+    return _has_met;
+}
+
+float EventKinematics::metPt() const
+{
+    return _met_pt;
+}
+
+float EventKinematics::metPhi() const
+{
+    return _met_phi;
+}
+
+const CutValues &EventKinematics::leptonJetDr(
+        const JetCollection &collection) const
+{
+    if (!_is_dr_valid[collection])
+    {
+        deltaR(_dr[collection], _leptons, _jets[collection]);
+
+        _is_dr_valid[collection] = true;
+    }
+
+    return _dr[collection];
+}
+
+float EventKinematics::leptonJetDr(const JetCollection &collection,
+        const uint32_t &jet,
+        const uint32_t &lepton) const
+{
+    return leptonJetDr(collection)[lepton * _jets[collection].size() + jet];
+}
+
+uint32_t EventKinematics::closestJet(const JetCollection &collection,
+        const uint32_t &lepton) const
+{
+    const uint32_t size = _jets[collection].size();
+    if (!size)
+        return 0;
+
+    const float *dr = &leptonJetDr(collection)[lepton * size];
+
+    uint32_t closest_jet = 0;
+    for(uint32_t jet = 1; size > jet; ++jet)
+    {
+        if (dr[jet] < dr[closest_jet])
+            closest_jet = jet;
+    }
+
+    return closest_jet;
+}
+
+float EventKinematics::leptonMetDphi(const uint32_t &lepton) const
+{
+    const float dphi = fabs(_leptons.phi[lepton] - _met_phi);
+
+    return dphi > M_PI ? 2 * M_PI - dphi : dphi;
+}
+
+float EventKinematics::jetMetDphi(const JetCollection &collection,
+        const uint32_t &jet) const
+{
+    const float dphi = fabs(_jets[collection].phi[jet] - _met_phi);
+
+    return dphi > M_PI ? 2 * M_PI - dphi : dphi;
+}
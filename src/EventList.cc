@@ -0,0 +1,393 @@
+// Event List
+//
+// Stream list of selected events into a file. Entries are kept in a buffer
+// of limited size; full buffer is sorted and spilled into the object part
+// file as a sorted run. Merged objects hand their runs over and save()
+// merges all runs into the ordered list
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <set>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/pointer_cast.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "bsm_core/interface/ID.h"
+#include "interface/EventList.h"
+
+using namespace std;
+
+using boost::dynamic_pointer_cast;
+using boost::lexical_cast;
+
+using bsm::EventList;
+
+namespace
+{
+    // Part files are opened by the analyzer threads
+    //
+    boost::mutex part_mutex;
+    uint32_t part_counter = 0;
+
+    uint32_t nextPart()
+    {
+        boost::mutex::scoped_lock lock(part_mutex);
+
+        return part_counter++;
+    }
+
+    // Sorted run reader keeps one block of entries in memory
+    //
+    struct RunReader
+    {
+        enum
+        {
+            BLOCK = 256
+        };
+
+        RunReader(ifstream *input, const uint64_t &offset, const uint32_t &size):
+            input(input),
+            offset(offset),
+            left(size),
+            position(0)
+        {
+        }
+
+        bool next(EventList::Entry &entry)
+        {
+            if (block.size() == position)
+            {
+                if (!left)
+                    return false;
+
+                block.resize(min<uint32_t>(left, BLOCK));
+
+                input->seekg(offset * sizeof(EventList::Entry));
+                input->read(reinterpret_cast<char *>(&block[0]),
+                            block.size() * sizeof(EventList::Entry));
+
+                if (!*input)
+                {
+                    cerr << "failed to read event list part" << endl;
+
+                    left = 0;
+                    block.clear();
+                    position = 0;
+
+                    return false;
+                }
+
+                offset += block.size();
+                left -= block.size();
+                position = 0;
+            }
+
+            entry = block[position++];
+
+            return true;
+        }
+
+        ifstream *input;
+        uint64_t offset;
+        uint32_t left;
+
+        vector<EventList::Entry> block;
+        uint32_t position;
+    };
+
+    typedef pair<EventList::Entry, uint32_t> Head;
+
+    // Priority queue keeps the smallest entry on top
+    //
+    struct HeadGreater
+    {
+        bool operator()(const Head &left, const Head &right) const
+        {
+            return right.first < left.first;
+        }
+    };
+}
+
+EventList::EventList():
+    _format(TEXT),
+    _buffer_size(4096),
+    _part_size(0),
+    _size(0)
+{
+}
+
+EventList::EventList(const EventList &object):
+    core::Object(),
+    _file_name(object._file_name),
+    _format(object._format),
+    _buffer_size(object._buffer_size),
+    _part_size(0),
+    _size(0)
+{
+}
+
+void EventList::setFile(const string &file_name)
+{
+    _file_name = file_name;
+}
+
+void EventList::setFormat(const Format &format)
+{
+    _format = format;
+}
+
+void EventList::setBufferSize(const uint32_t &size)
+{
+    _buffer_size = max<uint32_t>(size, 1);
+}
+
+bool EventList::isEnabled() const
+{
+    return !_file_name.empty();
+}
+
+void EventList::add(const uint32_t &run,
+        const uint32_t &lumi,
+        const uint32_t &event,
+        const float &value)
+{
+    if (!isEnabled())
+        return;
+
+    if (_entries.empty())
+        _entries.reserve(_buffer_size);
+
+    Entry entry;
+    entry.run = run;
+    entry.lumi = lumi;
+    entry.event = event;
+    entry.value = value;
+
+    _entries.push_back(entry);
+    ++_size;
+
+    if (_buffer_size <= _entries.size())
+        flush();
+}
+
+bool EventList::save()
+{
+    if (!isEnabled())
+        return false;
+
+    flush();
+    _part.reset();
+
+    ofstream output(_file_name.c_str(),
+                    BINARY == _format ? ios::out | ios::binary : ios::out);
+    if (!output.is_open())
+    {
+        cerr << "failed to open event list file: " << _file_name << endl;
+
+        removeParts();
+
+        return false;
+    }
+
+    typedef boost::shared_ptr<ifstream> InputPtr;
+    typedef map<string, InputPtr> Inputs;
+
+    Inputs inputs;
+    vector<RunReader> readers;
+    for(Runs::const_iterator run = _runs.begin(); _runs.end() != run; ++run)
+    {
+        InputPtr &input = inputs[run->part];
+        if (!input)
+        {
+            input.reset(new ifstream(run->part.c_str(),
+                                     ios::in | ios::binary));
+
+            if (!input->is_open())
+            {
+                cerr << "failed to open event list part: " << run->part
+                    << endl;
+
+                inputs.clear();
+                removeParts();
+
+                output.close();
+                remove(_file_name.c_str());
+
+                return false;
+            }
+        }
+
+        readers.push_back(RunReader(input.get(), run->offset, run->size));
+    }
+
+    // Merge sorted runs
+    //
+    priority_queue<Head, vector<Head>, HeadGreater> heads;
+    for(uint32_t reader = 0; readers.size() > reader; ++reader)
+    {
+        Entry entry;
+        if (readers[reader].next(entry))
+            heads.push(Head(entry, reader));
+    }
+
+    for(Entry entry; !heads.empty(); )
+    {
+        const Head head = heads.top();
+        heads.pop();
+
+        if (BINARY == _format)
+            output.write(reinterpret_cast<const char *>(&head.first),
+                         sizeof(Entry));
+        else
+            output << head.first.run << ":"
+                << head.first.lumi << ":"
+                << head.first.event << ":"
+                << head.first.value << "\n";
+
+        if (readers[head.second].next(entry))
+            heads.push(Head(entry, head.second));
+    }
+
+    inputs.clear();
+    removeParts();
+
+    output.close();
+    if (output.fail())
+    {
+        cerr << "failed to write event list file: " << _file_name << endl;
+
+        remove(_file_name.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t EventList::id() const
+{
+    return core::ID<EventList>::get();
+}
+
+EventList::ObjectPtr EventList::clone() const
+{
+    return ObjectPtr(new EventList(*this));
+}
+
+void EventList::merge(const ObjectPtr &pointer)
+{
+    if (pointer->id() != id())
+        return;
+
+    boost::shared_ptr<EventList> object =
+        dynamic_pointer_cast<EventList>(pointer);
+
+    if (!object)
+        return;
+
+    // Runs are handed over: the merged object part file is closed and a
+    // new one is started if the object is filled again
+    //
+    object->flush();
+    object->_part.reset();
+    object->_part_size = 0;
+
+    _runs.insert(_runs.end(), object->_runs.begin(), object->_runs.end());
+    object->_runs.clear();
+
+    _size += object->_size;
+    object->_size = 0;
+}
+
+void EventList::print(std::ostream &out) const
+{
+    if (!isEnabled())
+    {
+        out << "Event list is disabled";
+
+        return;
+    }
+
+    out << "Event list: " << _file_name << " (" << _size << " events)";
+}
+
+// Private
+//
+void EventList::removeParts()
+{
+    set<string> parts;
+    for(Runs::const_iterator run = _runs.begin(); _runs.end() != run; ++run)
+        parts.insert(run->part);
+
+    for(set<string>::const_iterator part = parts.begin();
+            parts.end() != part;
+            ++part)
+    {
+        remove(part->c_str());
+    }
+
+    _runs.clear();
+}
+
+void EventList::flush()
+{
+    if (_entries.empty())
+        return;
+
+    if (!_part)
+    {
+        _part_name = _file_name + ".part" + lexical_cast<string>(nextPart());
+        _part.reset(new ofstream(_part_name.c_str(),
+                                 ios::out | ios::binary));
+        _part_size = 0;
+
+        if (!_part->is_open())
+        {
+            cerr << "failed to open event list part: " << _part_name << endl;
+
+            _part.reset();
+            _entries.clear();
+
+            return;
+        }
+    }
+
+    sort(_entries.begin(), _entries.end());
+
+    Run run;
+    run.part = _part_name;
+    run.offset = _part_size;
+    run.size = _entries.size();
+
+    _part->write(reinterpret_cast<const char *>(&_entries[0]),
+                 _entries.size() * sizeof(Entry));
+    _part->flush();
+
+    _part_size += _entries.size();
+    _runs.push_back(run);
+
+    _entries.clear();
+}
+
+
+
+// Helpers
+//
+bool bsm::operator <(const EventList::Entry &left,
+        const EventList::Entry &right)
+{
+    if (left.run != right.run)
+        return left.run < right.run;
+
+    if (left.lumi != right.lumi)
+        return left.lumi < right.lumi;
+
+    return left.event < right.event;
+}
@@ -0,0 +1,239 @@
+// Generator decay index
+//
+// Event gen particles tree is flattened once per event into arrays. The tree
+// is walked breadth-first: children of every particle are stored next to
+// each other and always follow their parent. Decay modes of the W-bosons
+// and top quarks are resolved during the walk
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <cstdlib>
+
+#include "bsm_input/interface/Event.pb.h"
+#include "bsm_input/interface/GenParticle.pb.h"
+#include "interface/GenDecay.h"
+
+using namespace std;
+using namespace bsm;
+
+GenDecay::GenDecay()
+{
+}
+
+void GenDecay::fill(const Event *event)
+{
+    _particles.clear();
+    _ids.clear();
+    _statuses.clear();
+    _parents.clear();
+    _levels.clear();
+    _first_children.clear();
+    _children.clear();
+    _tags.clear();
+    _decays.clear();
+    _hard_particles.clear();
+
+    typedef ::google::protobuf::RepeatedPtrField<GenParticle> GenParticles;
+
+    const GenParticles &particles = event->gen_particle();
+    for(GenParticles::const_iterator particle = particles.begin();
+            particles.end() != particle;
+            ++particle)
+    {
+        add(*particle, NONE, 0, HARD);
+
+        if (3 == particle->status())
+            _hard_particles.push_back(_particles.size() - 1);
+    }
+
+    // Children are appended to the end of arrays: the loop visits them too
+    //
+    for(uint32_t index = 0; _particles.size() > index; ++index)
+    {
+        const GenParticles &children = _particles[index]->child();
+
+        _first_children[index] = _particles.size();
+        _children[index] = children.size();
+
+        uint32_t tags = _tags[index];
+        switch(abs(_ids[index]))
+        {
+            case 6: // top
+                tags |= FROM_TOP;
+                break;
+
+            case 15: // tau
+                tags |= FROM_TAU;
+                break;
+
+            case 24: // W-boson
+                tags |= FROM_W;
+                break;
+        }
+
+        for(GenParticles::const_iterator child = children.begin();
+                children.end() != child;
+                ++child)
+        {
+            add(*child, index, _levels[index] + 1, tags);
+        }
+    }
+
+    // Children always follow parents: resolve decays bottom-up
+    //
+    for(uint32_t index = _particles.size(); index; --index)
+    {
+        const uint32_t particle = index - 1;
+
+        switch(abs(_ids[particle]))
+        {
+            case 6: // top
+                {
+                    const uint32_t wboson = findChild(particle, 24);
+                    if (NONE != wboson)
+                        _decays[particle] = _decays[wboson];
+
+                    break;
+                }
+
+            case 24: // W-boson
+                _decays[particle] = wbosonDecay(particle);
+                break;
+        }
+    }
+}
+
+uint32_t GenDecay::size() const
+{
+    return _particles.size();
+}
+
+const GenParticle &GenDecay::particle(const uint32_t &index) const
+{
+    return *_particles[index];
+}
+
+int GenDecay::id(const uint32_t &index) const
+{
+    return _ids[index];
+}
+
+int GenDecay::status(const uint32_t &index) const
+{
+    return _statuses[index];
+}
+
+uint32_t GenDecay::parent(const uint32_t &index) const
+{
+    return _parents[index];
+}
+
+uint32_t GenDecay::level(const uint32_t &index) const
+{
+    return _levels[index];
+}
+
+uint32_t GenDecay::firstChild(const uint32_t &index) const
+{
+    return _first_children[index];
+}
+
+uint32_t GenDecay::children(const uint32_t &index) const
+{
+    return _children[index];
+}
+
+uint32_t GenDecay::tags(const uint32_t &index) const
+{
+    return _tags[index];
+}
+
+bool GenDecay::is(const uint32_t &index, const Tag &tag) const
+{
+    return _tags[index] & tag;
+}
+
+GenDecay::Decay GenDecay::decay(const uint32_t &index) const
+{
+    return static_cast<Decay>(_decays[index]);
+}
+
+uint32_t GenDecay::findChild(const uint32_t &particle,
+        const int &abs_id) const
+{
+    for(uint32_t child = _first_children[particle],
+                end = child + _children[particle];
+            end > child;
+            ++child)
+    {
+        if (3 == _statuses[child]
+                && abs_id == abs(_ids[child]))
+            return child;
+    }
+
+    return NONE;
+}
+
+const GenDecay::Indices &GenDecay::hardParticles() const
+{
+    return _hard_particles;
+}
+
+// Private
+//
+void GenDecay::add(const GenParticle &particle,
+        const uint32_t &parent,
+        const uint32_t &level,
+        const uint32_t &tags)
+{
+    _particles.push_back(&particle);
+    _ids.push_back(particle.id());
+    _statuses.push_back(particle.status());
+    _parents.push_back(parent);
+    _levels.push_back(level);
+    _first_children.push_back(NONE);
+    _children.push_back(0);
+    _tags.push_back(3 == particle.status() ? tags : tags & ~HARD);
+    _decays.push_back(UNKNOWN);
+}
+
+GenDecay::Decay GenDecay::wbosonDecay(const uint32_t &wboson) const
+{
+    bool has_children = false;
+    bool has_neutrino = false;
+
+    for(uint32_t child = _first_children[wboson],
+                end = child + _children[wboson];
+            end > child;
+            ++child)
+    {
+        if (3 != _statuses[child])
+            continue;
+
+        has_children = true;
+
+        // The first charged lepton defines the flavour. Neutrino alone
+        // does not
+        //
+        switch(abs(_ids[child]))
+        {
+            case 11: // Electron
+                return ELECTRON;
+
+            case 13: // Muon
+                return MUON;
+
+            case 15: // Tau
+                return TAU;
+
+            case 12: // Ele-neutrino
+            case 14: // Mu-neutrino
+            case 16: // Tau-neutrino
+                has_neutrino = true;
+                break;
+        }
+    }
+
+    return has_children && !has_neutrino ? HADRONIC : UNKNOWN;
+}
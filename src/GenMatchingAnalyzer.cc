@@ -48,20 +48,6 @@ GenMatchingAnalyzer::GenMatchingAnalyzer():
     _synch_selector->met()->disable();
     monitor(_synch_selector);
 
-    // Assign cutflow delegate
-    //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
-    {
-        Counter *counter = _synch_selector->cutflow()->cut(cut)->events().get();
-        _counters[counter] = cut;
-
-        counter->setDelegate(this);
-    }
-
-    _cutflow.reset(new H1Proxy(SynchSelector::SELECTIONS, 0,
-                SynchSelector::SELECTIONS));
-    monitor(_cutflow);
-
     _ltop_drsum.reset(new H1Proxy(50, 0, 5));
     monitor(_ltop_drsum);
 
@@ -105,6 +91,8 @@ GenMatchingAnalyzer::GenMatchingAnalyzer():
 
     _reconstructor.reset(new SimpleResonanceReconstructor());
     monitor(_reconstructor);
+
+    registerOutputs();
 }
 
 GenMatchingAnalyzer::GenMatchingAnalyzer(const GenMatchingAnalyzer &object):
@@ -118,19 +106,6 @@ GenMatchingAnalyzer::GenMatchingAnalyzer(const GenMatchingAnalyzer &object):
         dynamic_pointer_cast<SynchSelector>(object._synch_selector->clone());
     monitor(_synch_selector);
 
-    // Assign cutflow delegate
-    //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
-    {
-        Counter *counter = _synch_selector->cutflow()->cut(cut)->events().get();
-        _counters[counter] = cut;
-
-        counter->setDelegate(this);
-    }
-
-    _cutflow = dynamic_pointer_cast<H1Proxy>(object._cutflow->clone());
-    monitor(_cutflow);
-
     _ltop_drsum = dynamic_pointer_cast<H1Proxy>(object._ltop_drsum->clone());
     monitor(_ltop_drsum);
 
@@ -164,11 +139,25 @@ GenMatchingAnalyzer::GenMatchingAnalyzer(const GenMatchingAnalyzer &object):
     _reconstructor = 
         dynamic_pointer_cast<ResonanceReconstructor>(object._reconstructor->clone());
     monitor(_reconstructor);
+
+    registerOutputs();
 }
 
 const GenMatchingAnalyzer::H1Ptr GenMatchingAnalyzer::cutflow() const
 {
-    return _cutflow->histogram();
+    // Cutflow is kept by the selector counters
+    //
+    H1Ptr cutflow(new stat::H1(SynchSelector::SELECTIONS, 0,
+                SynchSelector::SELECTIONS));
+
+    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
+    {
+        const CounterPtr events = _synch_selector->cutflow()->cut(cut)->events();
+        if (events->counts())
+            cutflow->fill(cut, events->counts());
+    }
+
+    return cutflow;
 }
 
 const GenMatchingAnalyzer::H1Ptr GenMatchingAnalyzer::ltop_drsum() const
@@ -216,6 +205,11 @@ const GenMatchingAnalyzer::P4MonitorPtr GenMatchingAnalyzer::ttbar() const
     return _ttbar;
 }
 
+const bsm::OutputRegistry *GenMatchingAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 bsm::JetEnergyCorrectionDelegate
     *GenMatchingAnalyzer::getJetEnergyCorrectionDelegate() const
 {
@@ -251,12 +245,6 @@ void GenMatchingAnalyzer::setChi2Reconstruction(const Chi2Discriminators &ltop,
     monitor(_reconstructor);
 }
 
-void GenMatchingAnalyzer::didCounterAdd(const Counter *counter)
-{
-    if (_counters.end() != _counters.find(counter))
-        cutflow()->fill(_counters[counter]);
-}
-
 void GenMatchingAnalyzer::onFileOpen(const std::string &filename, const Input *input)
 {
 }
@@ -270,8 +258,10 @@ void GenMatchingAnalyzer::process(const Event *event)
     //
     if (_synch_selector->apply(event))
     {
+        _gen_decay.fill(event);
+
         gen::TTbar resonance;
-        resonance.fill(event);
+        resonance.fill(_gen_decay);
 
         // Prepare collection of corrected jets
         //
@@ -318,22 +308,22 @@ void GenMatchingAnalyzer::process(const Event *event)
                     ++neutrino)
             {
                 float deltar = dr(
-                        **neutrino,
+                        *neutrino,
                         resonance.ltop.wboson.neutrino->physics_object().p4());
 
                 if (deltar < best_dr)
                 {
                     best_dr = deltar;
-                    nu_p4 = &**neutrino;
+                    nu_p4 = &*neutrino;
                 }
             }
 
             LorentzVector ltop_p4 = el_p4;
             ltop_p4 += *nu_p4;
-            ltop_p4 += *resonance.ltop.jets.begin()->jet->corrected_p4;
+            ltop_p4 += resonance.ltop.jets.begin()->jet->corrected_p4;
 
             gen::CorrectedJets used_jets;
-            LorentzVector htop_p4 = *resonance.htop.jets.begin()->jet->corrected_p4;
+            LorentzVector htop_p4 = resonance.htop.jets.begin()->jet->corrected_p4;
             used_jets.push_back(resonance.htop.jets.begin()->jet);
 
             for(vector<gen::MatchedJet>::const_iterator matched_jet =
@@ -355,7 +345,7 @@ void GenMatchingAnalyzer::process(const Event *event)
                                             matched_jet->jet))
                     continue;
 
-                htop_p4 += *matched_jet->jet->corrected_p4;
+                htop_p4 += matched_jet->jet->corrected_p4;
                 used_jets.push_back(matched_jet->jet);
             }
 
@@ -378,7 +368,7 @@ void GenMatchingAnalyzer::process(const Event *event)
 
             ltop_drsum()->fill(dr(ltop_p4, el_p4) +
                                dr(ltop_p4, *nu_p4) +
-                               dr(ltop_p4, *resonance.ltop.jets.begin()->jet->corrected_p4));
+                               dr(ltop_p4, resonance.ltop.jets.begin()->jet->corrected_p4));
 
             float drsum = 0;
 
@@ -395,7 +385,7 @@ void GenMatchingAnalyzer::process(const Event *event)
                                             matched_jet->jet))
                     continue;
 
-                drsum += dr(htop_p4, *matched_jet->jet->corrected_p4);
+                drsum += dr(htop_p4, matched_jet->jet->corrected_p4);
                 used_jets.push_back(matched_jet->jet);
             }
 
@@ -468,11 +458,6 @@ void GenMatchingAnalyzer::merge(const ObjectPtr &pointer)
     if (!object)
         return;
 
-    // Reset counter delegates
-    //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS < cut; ++cut)
-        _synch_selector->cutflow()->cut(cut)->events().get()->setDelegate(0);
-
     _matching_events += object->_matching_events;
     _ltop_match += object->_ltop_match;
     _htop_match += object->_htop_match;
@@ -506,6 +491,26 @@ void GenMatchingAnalyzer::print(std::ostream &out) const
 
 // Private
 //
+void GenMatchingAnalyzer::registerOutputs()
+{
+    _outputs.add("cutflow",
+            _synch_selector->cutflow(),
+            OutputRegistry::CUTFLOW_EVENTS);
+
+    _outputs.add("ltop_drsum", _ltop_drsum);
+    _outputs.add("htop_drsum", _htop_drsum);
+    _outputs.add("htop_dphi", _htop_dphi);
+
+    _outputs.add("ltop", _ltop, "ltop");
+    _outputs.add("htop", _htop, "htop");
+
+    _outputs.add("htop_1jet", _htop_1jet, "htop_1jet");
+    _outputs.add("htop_2jet", _htop_2jet, "htop_2jet");
+    _outputs.add("htop_3jet", _htop_3jet, "htop_3jet");
+
+    _outputs.add("ttbar", _ttbar, "ttbar");
+}
+
 bool GenMatchingAnalyzer::is_match(const gen::TTbar &gen, const Mttbar &reco)
 {
     typedef ResonanceReconstructor::CorrectedJets CorrectedJets;
@@ -570,26 +575,21 @@ bool GenMatchingAnalyzer::is_match(const gen::TTbar &gen, const Mttbar &reco)
 
 
 
-void gen::TTbar::fill(const Event *event)
+void gen::TTbar::fill(const GenDecay &gen_decay)
 {
-    typedef ::google::protobuf::RepeatedPtrField<GenParticle> GenParticles;
-
-    const GenParticles &particles = event->gen_particle();
-    for(GenParticles::const_iterator particle = particles.begin();
+    // Hard particles are the top level status 3 particles
+    //
+    const GenDecay::Indices &particles = gen_decay.hardParticles();
+    for(GenDecay::Indices::const_iterator particle = particles.begin();
             particles.end() != particle;
             ++particle)
     {
-        // Skip all unstable products
-        //
-        if (3 != particle->status())
-            continue;
-
         // Process t-quarks only
         //
-        if (6 == abs(particle->id()))
+        if (6 == abs(gen_decay.id(*particle)))
         {
             Top top;
-            top.fill(*particle);
+            top.fill(gen_decay, *particle);
 
             switch(top.wboson.decay)
             {
@@ -620,28 +620,26 @@ bool gen::TTbar::match(CorrectedJets &corrected_jets)
 
 
 
-void gen::Top::fill(const GenParticle &particle)
+void gen::Top::fill(const GenDecay &gen_decay, const uint32_t &top)
 {
-    typedef ::google::protobuf::RepeatedPtrField<GenParticle> GenParticles;
-
-    const GenParticles &particles = particle.child();
-    for(GenParticles::const_iterator child = particles.begin();
-            particles.end() != child;
+    for(uint32_t child = gen_decay.firstChild(top),
+                end = child + gen_decay.children(top);
+            end > child;
             ++child)
     {
         // Skip all unstable particles
         //
-        if (3 != child->status())
+        if (3 != gen_decay.status(child))
             continue;
 
-        if (24 == abs(child->id()))
+        if (24 == abs(gen_decay.id(child)))
         {
-            wboson.fill(*child);
+            wboson.fill(gen_decay, child);
         }
         else
         {
             MatchedJet jet;
-            jet.parton = &*child;
+            jet.parton = &gen_decay.particle(child);
 
             jets.push_back(jet);
         }
@@ -701,57 +699,58 @@ bool gen::Top::match(CorrectedJets &corrected_jets)
 
 
 
-void gen::Wboson::fill(const GenParticle &particle)
+void gen::Wboson::fill(const GenDecay &gen_decay, const uint32_t &wboson)
 {
-    typedef ::google::protobuf::RepeatedPtrField<GenParticle> GenParticles;
+    switch(gen_decay.decay(wboson))
+    {
+        case GenDecay::ELECTRON:
+            decay = ELECTRON;
+            break;
+
+        case GenDecay::MUON:
+            decay = MUON;
+            break;
+
+        case GenDecay::TAU:
+            decay = TAU;
+            break;
+
+        case GenDecay::HADRONIC:
+            decay = HADRONIC;
+            break;
 
-    const GenParticles &particles = particle.child();
-    for(GenParticles::const_iterator child = particles.begin();
-            particles.end() != child;
+        default:
+            decay = UNKNOWN;
+            break;
+    }
+
+    for(uint32_t child = gen_decay.firstChild(wboson),
+                end = child + gen_decay.children(wboson);
+            end > child;
             ++child)
     {
         // Skip all unstable particles
         //
-        if (3 != child->status())
+        if (3 != gen_decay.status(child))
             continue;
 
-        switch(abs(child->id()))
+        switch(abs(gen_decay.id(child)))
         {
             case 11: // Electron
-                decay = ELECTRON;
-                lepton = &*child;
-                break;
-
-            case 12: // Ele-neutrino
-                decay = ELECTRON;
-                neutrino = &*child;
-                break;
-
             case 13: // Muon
-                decay = MUON;
-                lepton = &*child;
-                break;
-
-            case 14: // Mu-neutrino
-                decay = MUON;
-                neutrino = &*child;
-                break;
-
             case 15: // Tau
-                decay = TAU;
-                lepton = &*child;
+                lepton = &gen_decay.particle(child);
                 break;
 
+            case 12: // Ele-neutrino
+            case 14: // Mu-neutrino
             case 16: // Tau-neutrino
-                decay = TAU;
-                neutrino = &*child;
+                neutrino = &gen_decay.particle(child);
                 break;
 
             default: // hadronic decay
-                decay = HADRONIC;
-
                 MatchedJet jet;
-                jet.parton = &*child;
+                jet.parton = &gen_decay.particle(child);
 
                 jets.push_back(jet);
                 break;
@@ -819,7 +818,7 @@ bool gen::MatchedJet::match(CorrectedJets &corrected_jets)
             corrected_jets.end() != corrected_jet;
             ++corrected_jet)
     {
-        if (0.3 > dr(parton->physics_object().p4(), *(*corrected_jet)->corrected_p4))
+        if (0.3 > dr(parton->physics_object().p4(), (*corrected_jet)->corrected_p4))
         {
             jet = *corrected_jet;
 
@@ -207,6 +207,8 @@ HadronicTopAnalyzer::HadronicTopAnalyzer():
 
     _reconstructor.reset(new SimpleResonanceReconstructor());
     monitor(_reconstructor);
+
+    registerOutputs();
 }
 
 HadronicTopAnalyzer::HadronicTopAnalyzer(const HadronicTopAnalyzer &object):
@@ -315,6 +317,8 @@ HadronicTopAnalyzer::HadronicTopAnalyzer(const HadronicTopAnalyzer &object):
 
     _reconstructor = dynamic_pointer_cast<ResonanceReconstructor>(object._reconstructor->clone());
     monitor(_reconstructor);
+
+    registerOutputs();
 }
 
 void HadronicTopAnalyzer::setBtagReconstruction()
@@ -540,6 +544,11 @@ const HadronicTopAnalyzer::DeltaMonitorPtr HadronicTopAnalyzer::ttbar_gen_delta(
     return _ttbar_gen_delta;
 }
 
+const bsm::OutputRegistry *HadronicTopAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 bsm::JetEnergyCorrectionDelegate
     *HadronicTopAnalyzer::getJetEnergyCorrectionDelegate() const
 {
@@ -688,7 +697,7 @@ void HadronicTopAnalyzer::process(const Event *event)
 
             if (0 < njets_)
             {
-                const LorentzVector &jet1_p4 = *htop_jets[0].corrected_p4;
+                const LorentzVector &jet1_p4 = htop_jets[0].corrected_p4;
                 jet1()->fill(jet1_p4, _pileup_weight);
 
                 const Jet *raw_jet1 = htop_jets[0].jet;
@@ -697,7 +706,7 @@ void HadronicTopAnalyzer::process(const Event *event)
             
                 if (1 < njets_)
                 {
-                    const LorentzVector &jet2_p4 = *htop_jets[1].corrected_p4;
+                    const LorentzVector &jet2_p4 = htop_jets[1].corrected_p4;
                     jet2()->fill(jet2_p4, _pileup_weight);
 
                     jet1_vs_jet2()->fill(jet1_p4, jet2_p4, _pileup_weight);
@@ -716,7 +725,7 @@ void HadronicTopAnalyzer::process(const Event *event)
 
                     if (2 < njets_)
                     {
-                        const LorentzVector &jet3_p4 = *htop_jets[2].corrected_p4;
+                        const LorentzVector &jet3_p4 = htop_jets[2].corrected_p4;
                         jet3()->fill(jet3_p4, _pileup_weight);
 
                         jet1_vs_jet3()->fill(jet1_p4, jet3_p4, _pileup_weight);
@@ -724,7 +733,7 @@ void HadronicTopAnalyzer::process(const Event *event)
 
                         if (3 < njets_)
                         {
-                            const LorentzVector &jet4_p4 = *htop_jets[3].corrected_p4;
+                            const LorentzVector &jet4_p4 = htop_jets[3].corrected_p4;
                             jet4()->fill(jet4_p4, _pileup_weight);
 
                             jet1_vs_jet4()->fill(jet1_p4, jet4_p4, _pileup_weight);
@@ -779,6 +788,54 @@ void HadronicTopAnalyzer::print(std::ostream &out) const
 
 // Private
 //
+void HadronicTopAnalyzer::registerOutputs()
+{
+    _outputs.add("top", _top, "top");
+
+    _outputs.add("njets", _njets, "", "top");
+    _outputs.add("njets_vs_mass", _njets_vs_mass, "", "", "top");
+    _outputs.add("pt_vs_mass", _pt_vs_mass, "", "", "top");
+    _outputs.add("njets_vs_pt", _njets_vs_pt, "", "", "top");
+
+    _outputs.add("jet1", _jet1, "jet1");
+    _outputs.add("jet2", _jet2, "jet2");
+    _outputs.add("jet3", _jet3, "jet3");
+    _outputs.add("jet4", _jet4, "jet4");
+
+    _outputs.add("jet1_parton", _jet1_parton, "jet1_parton");
+    _outputs.add("jet2_parton", _jet2_parton, "jet2_parton");
+
+    _outputs.add("jet1_parton_vs_jet2_parton", _jet1_parton_vs_jet2_parton);
+
+    _outputs.add("jet1_vs_jet2", _jet1_vs_jet2);
+    _outputs.add("jet1_vs_jet3", _jet1_vs_jet3);
+    _outputs.add("jet1_vs_jet4", _jet1_vs_jet4);
+    _outputs.add("jet2_vs_jet3", _jet2_vs_jet3);
+    _outputs.add("jet2_vs_jet4", _jet2_vs_jet4);
+    _outputs.add("jet3_vs_jet4", _jet3_vs_jet4);
+
+    // Generator particles
+    //
+    _outputs.add("gen_top", _gen_top, "gen_top");
+
+    _outputs.add("njets", _njets_gen, "", "gen_top");
+    _outputs.add("njets_vs_mass", _njets_gen_vs_gen_mass, "", "", "gen_top");
+    _outputs.add("pt_vs_mass", _pt_gen_vs_gen_mass, "", "", "gen_top");
+    _outputs.add("njets_vs_pt", _njets_gen_vs_gen_pt, "", "", "gen_top");
+
+    _outputs.add("gen_jet1", _gen_jet1, "gen_jet1");
+    _outputs.add("gen_jet2", _gen_jet2, "gen_jet2");
+    _outputs.add("gen_jet3", _gen_jet3, "gen_jet3");
+
+    // TTbar system
+    //
+    _outputs.add("ttbar_reco", _ttbar_reco, "ttbar_reco");
+    _outputs.add("ttbar_gen", _ttbar_gen, "ttbar_gen");
+
+    _outputs.add("ttbar_reco_delta", _ttbar_reco_delta, "ttbar_reco_delta");
+    _outputs.add("ttbar_gen_delta", _ttbar_gen_delta, "ttbar_gen_delta");
+}
+
 HadronicTopAnalyzer::Mttbar HadronicTopAnalyzer::mttbar() const
 {
     // Note: leptons are kept in a vector of pointers
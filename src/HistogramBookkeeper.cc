@@ -37,10 +37,52 @@ static TH2Ptr convert(string const & name, const H2 &h2)
 
 HistogramBookkeeper::HistogramBookkeeper(HistogramBookkeeper const & object)
 {
-    for ( H1ProxyPtrContainer::const_iterator h1 = object._cache1d.begin(); h1 != object._cache1d.end(); ++h1 )
-        _cache1d[h1->first].reset(new H1Proxy(*h1->second));
-    for ( H2ProxyPtrContainer::const_iterator h2 = object._cache2d.begin(); h2 != object._cache2d.end(); ++h2 )
-        _cache2d[h2->first].reset(new H2Proxy(*h2->second));
+    // Copy in the booking order to keep handles valid
+    for (uint32_t index = 0; index < object._cache1d.size(); ++index)
+        add1d(object._keys1d[index], H1ProxyPtr(new H1Proxy(*object._cache1d[index])));
+    for (uint32_t index = 0; index < object._cache2d.size(); ++index)
+        add2d(object._keys2d[index], H2ProxyPtr(new H2Proxy(*object._cache2d[index])));
+}
+
+
+HistogramBookkeeper::H1Handle HistogramBookkeeper::book1d(string const & key,
+        uint32_t const & bins, float const & min, float const & max
+    )
+{
+    H1ProxyPtr proxy(new H1Proxy(bins, min, max));
+
+    Indices::const_iterator index = _indices1d.find(key);
+    if (index == _indices1d.end())
+    {
+        add1d(key, proxy);
+        return H1Handle(_cache1d.size() - 1);
+    }
+
+    _cache1d[index->second] = proxy;
+    _histograms1d[index->second] = proxy->histogram().get();
+
+    return H1Handle(index->second);
+}
+
+
+HistogramBookkeeper::H2Handle HistogramBookkeeper::book2d(string const & key,
+        uint32_t const & xbins, float const & xmin, float const & xmax,
+        uint32_t const & ybins, float const & ymin, float const & ymax
+    )
+{
+    H2ProxyPtr proxy(new H2Proxy(xbins, xmin, xmax, ybins, ymin, ymax));
+
+    Indices::const_iterator index = _indices2d.find(key);
+    if (index == _indices2d.end())
+    {
+        add2d(key, proxy);
+        return H2Handle(_cache2d.size() - 1);
+    }
+
+    _cache2d[index->second] = proxy;
+    _histograms2d[index->second] = proxy->histogram().get();
+
+    return H2Handle(index->second);
 }
 
 
@@ -55,23 +97,35 @@ void HistogramBookkeeper::merge(const ObjectPtr & pointer)
     if (!object)
         return;
 
-    for ( H1ProxyPtrContainer::const_iterator h1 = object->_cache1d.begin(); h1 != object->_cache1d.end(); ++h1 )
-        _cache1d[h1->first]->merge(h1->second);
-    for ( H2ProxyPtrContainer::const_iterator h2 = object->_cache2d.begin(); h2 != object->_cache2d.end(); ++h2 )
-        _cache2d[h2->first]->merge(h2->second);
+    // Bookkeepers are copies of each other: histograms are merged index by
+    // index. Keys are used only if booking order is different
+    for (uint32_t index = 0; index < object->_cache1d.size(); ++index)
+    {
+        if (index < _keys1d.size() && _keys1d[index] == object->_keys1d[index])
+            _cache1d[index]->merge(object->_cache1d[index]);
+        else
+            _cache1d.at(_indices1d.at(object->_keys1d[index]))->merge(object->_cache1d[index]);
+    }
+    for (uint32_t index = 0; index < object->_cache2d.size(); ++index)
+    {
+        if (index < _keys2d.size() && _keys2d[index] == object->_keys2d[index])
+            _cache2d[index]->merge(object->_cache2d[index]);
+        else
+            _cache2d.at(_indices2d.at(object->_keys2d[index]))->merge(object->_cache2d[index]);
+    }
 }
 
 
 void HistogramBookkeeper::write() const
 {
-    for ( H1ProxyPtrContainer::const_iterator h1 = _cache1d.begin(); h1 != _cache1d.end(); ++h1 )
+    for (uint32_t index = 0; index < _cache1d.size(); ++index)
     {
-        TH1Ptr th1 = convert(h1->first, (*h1->second->histogram()));
+        TH1Ptr th1 = convert(_keys1d[index], *_histograms1d[index]);
         th1->Write();
     }
-    for ( H2ProxyPtrContainer::const_iterator h2 = _cache2d.begin(); h2 != _cache2d.end(); ++h2 )
+    for (uint32_t index = 0; index < _cache2d.size(); ++index)
     {
-        TH2Ptr th2 = convert(h2->first, (*h2->second->histogram()));
+        TH2Ptr th2 = convert(_keys2d[index], *_histograms2d[index]);
         th2->Write();
     }
 }
@@ -79,10 +133,7 @@ void HistogramBookkeeper::write() const
 
 void HistogramBookkeeper::print(std::ostream & os) const
 {
-    vector<string> keys;
-
-    for ( H1ProxyPtrContainer::const_iterator h1 = _cache1d.begin(); h1 != _cache1d.end(); ++h1 )
-        keys.push_back(h1->first);
+    vector<string> keys(_keys1d);
 
     sort(keys.begin(), keys.end());
 
@@ -90,22 +141,39 @@ void HistogramBookkeeper::print(std::ostream & os) const
     os << "========================================\n";
 
     for (vector<string>::const_iterator key = keys.begin(); key != keys.end(); ++key)
-        os << format ("%-30s : %7d\n") % (*key) % _cache1d.at(*key)->histogram()->entries();
+        os << format ("%-30s : %7d\n") % (*key) % _histograms1d[_indices1d.at(*key)]->entries();
 
     os << "\n";
 
     os << format("Number of 2d histograms: %d\n") % _cache2d.size();
     os << "========================================\n";
 
-    keys.clear();
-
-    for ( H2ProxyPtrContainer::const_iterator h2 = _cache2d.begin(); h2 != _cache2d.end(); ++h2 )
-        keys.push_back(h2->first);
+    keys = _keys2d;
 
     sort(keys.begin(), keys.end());
 
     for (vector<string>::const_iterator key = keys.begin(); key != keys.end(); ++key)
-        os << format ("%-30s : %7d\n") % (*key) % _cache1d.at(*key)->histogram()->entries();
+        os << format ("%-30s : %7d\n") % (*key) % convert(*_histograms2d[_indices2d.at(*key)])->GetEntries();
+}
+
+
+// Private
+
+void HistogramBookkeeper::add1d(string const & key, H1ProxyPtr const & proxy)
+{
+    _indices1d[key] = _cache1d.size();
+    _keys1d.push_back(key);
+    _cache1d.push_back(proxy);
+    _histograms1d.push_back(proxy->histogram().get());
+}
+
+
+void HistogramBookkeeper::add2d(string const & key, H2ProxyPtr const & proxy)
+{
+    _indices2d[key] = _cache2d.size();
+    _keys2d.push_back(key);
+    _cache2d.push_back(proxy);
+    _histograms2d.push_back(proxy->histogram().get());
 }
 
 
@@ -57,6 +57,8 @@ JetAnalyzer::JetAnalyzer()
     monitor(_hlt_leading_jet);
     monitor(_selected_hlt_leading_jet);
     monitor(_reco_leading_jet);
+
+    registerOutputs();
 }
 
 JetAnalyzer::JetAnalyzer(const JetAnalyzer &object):
@@ -82,6 +84,8 @@ JetAnalyzer::JetAnalyzer(const JetAnalyzer &object):
     monitor(_hlt_leading_jet);
     monitor(_selected_hlt_leading_jet);
     monitor(_reco_leading_jet);
+
+    registerOutputs();
 }
 
 bsm::JetEnergyCorrectionDelegate *JetAnalyzer::getJetEnergyCorrectionDelegate() const
@@ -109,6 +113,11 @@ const JetAnalyzer::P4MonitorPtr JetAnalyzer::recoLeadingJetMonitor() const
     return _reco_leading_jet;
 }
 
+const bsm::OutputRegistry *JetAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 void JetAnalyzer::onFileOpen(const std::string &filename, const Input *input)
 {
 }
@@ -188,14 +197,13 @@ void JetAnalyzer::process(const Event *event)
         // Sort corrected jet p4's by pt
         //
         typedef SynchSelector::GoodJets GoodJets;
-        typedef SynchSelector::LorentzVectorPtr LorentzVectorPtr;
 
-        vector<LorentzVectorPtr> corrected_p4;
+        vector<const LorentzVector *> corrected_p4;
         for(GoodJets::const_iterator good_jet = _synch_selector->goodJets().begin();
                 _synch_selector->goodJets().end() != good_jet;
                 ++good_jet)
         {
-            corrected_p4.push_back(good_jet->corrected_p4);
+            corrected_p4.push_back(&good_jet->corrected_p4);
         }
 
         sort(corrected_p4.begin(), corrected_p4.end(), PtGreater());
@@ -222,3 +230,12 @@ void JetAnalyzer::print(std::ostream &out) const
     out << "Jet Analyzer" << endl;
     out << *_synch_selector;
 }
+
+// Private
+//
+void JetAnalyzer::registerOutputs()
+{
+    _outputs.add("Reco Leading Jet", _reco_leading_jet);
+    _outputs.add("HLT Leading Jet", _hlt_leading_jet);
+    _outputs.add("Selected HLT Leading Jet", _selected_hlt_leading_jet);
+}
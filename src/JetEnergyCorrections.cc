@@ -6,13 +6,16 @@
 // Copyright 2011, All rights reserved
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <ostream>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/pointer_cast.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "bsm_core/interface/ID.h"
 #include "bsm_input/interface/Algebra.h"
@@ -80,6 +83,20 @@ JetEnergyCorrectionOptions::JetEnergyCorrectionOptions()
              boost::bind(&JetEnergyCorrectionOptions::setChildCorrection,
                  this)),
          "Use jet constituents p4 to clean up the jet")
+
+        ("jec-grid",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&JetEnergyCorrectionOptions::setCorrectionGrid,
+                 this, _1)),
+         "Interpolate corrections on precomputed (eta bin, pt, area, rho) "
+         "grid. Levels that depend on NPV or jet energy are corrected exactly")
+
+        ("jec-grid-validate",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(
+                 &JetEnergyCorrectionOptions::setCorrectionGridValidation,
+                 this, _1)),
+         "Compare grid with exact corrections and report max deviation")
     ;
 }
 
@@ -170,54 +187,450 @@ void JetEnergyCorrectionOptions::setChildCorrection()
     delegate()->setChildCorrection();
 }
 
+void JetEnergyCorrectionOptions::setCorrectionGrid(const bool &value)
+{
+    if (!delegate()
+            || !value)
+        return;
+
+    delegate()->setCorrectionGrid(false);
+}
 
+void JetEnergyCorrectionOptions::setCorrectionGridValidation(const bool &value)
+{
+    if (!delegate()
+            || !value)
+        return;
 
-// Jet Energy Corrections
+    delegate()->setCorrectionGrid(true);
+}
+
+
+
+// Jet Correction Grid
 //
-JetEnergyCorrections::JetEnergyCorrections()
+namespace
 {
+    // Grid keeps parameters constant within eta bin. Other variables of
+    // the formula should be tabulated: levels that use anything else
+    // (NPV, jet energy, ...) are corrected exactly
+    //
+    bool isGridSupported(const JetCorrectorParameters &parameters,
+            const string *variables,
+            const uint32_t &size)
+    {
+        const JetCorrectorParameters::Definitions &definitions =
+            parameters.definitions();
+
+        if (1 != definitions.nBinVar()
+                || "JetEta" != definitions.binVar(0))
+            return false;
+
+        for(uint32_t variable = 0; definitions.nParVar() > variable; ++variable)
+        {
+            if (variables + size == find(variables, variables + size,
+                        definitions.parVar(variable)))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+namespace bsm
+{
+    // Uniform grid axis
+    //
+    class GridAxis
+    {
+        public:
+            GridAxis(const uint32_t &points, const float &min, const float &max):
+                _points(points),
+                _min(min),
+                _step((max - min) / (points - 1))
+            {
+            }
+
+            uint32_t points() const
+            {
+                return _points;
+            }
+
+            float value(const uint32_t &point) const
+            {
+                return _min + point * _step;
+            }
+
+            // Find lower grid point and fraction of the step to the next
+            // point. Values outside of the grid are not found
+            //
+            bool locate(const float &value,
+                    uint32_t &point,
+                    float &fraction) const
+            {
+                const float position = (value - _min) / _step;
+                if (!(0 <= position
+                        && _points - 1 >= position))
+                    return false;
+
+                point = std::min(static_cast<uint32_t>(position), _points - 2);
+                fraction = position - point;
+
+                return true;
+            }
+
+        private:
+            uint32_t _points;
+            float _min;
+            float _step;
+    };
+
+    // Union of eta bins of the parameters. Every level is constant within
+    // a bin: values are taken in the bin center and are never
+    // interpolated across bin edges
+    //
+    class EtaBins
+    {
+        public:
+            void add(const JetCorrectorParameters &parameters)
+            {
+                for(uint32_t record = 0; parameters.size() > record; ++record)
+                {
+                    _edges.push_back(parameters.record(record).xMin(0));
+                    _edges.push_back(parameters.record(record).xMax(0));
+                }
+
+                sort(_edges.begin(), _edges.end());
+                _edges.erase(unique(_edges.begin(), _edges.end()),
+                        _edges.end());
+            }
+
+            uint32_t bins() const
+            {
+                return 1 < _edges.size()
+                    ? _edges.size() - 1
+                    : 0;
+            }
+
+            float center(const uint32_t &bin) const
+            {
+                return (_edges[bin] + _edges[bin + 1]) / 2;
+            }
+
+            bool locate(const float &eta, uint32_t &bin) const
+            {
+                if (!bins()
+                        || !(_edges.front() <= eta
+                            && _edges.back() > eta))
+                    return false;
+
+                bin = upper_bound(_edges.begin(), _edges.end(), eta)
+                    - _edges.begin() - 1;
+
+                return true;
+            }
+
+        private:
+            std::vector<float> _edges;
+    };
+
+    // Corrections are tabulated on (eta bin, log(pt), area, rho) grid and
+    // uncertainty on (eta bin, log(pt)) grid. Values are interpolated
+    // linearly in all variables but eta.
+    //
+    // Note: L1 FastJet offset depends on both jet area and rho, therefore
+    //       rho is a separate axis
+    //
+    class JetCorrectionGrid
+    {
+        public:
+            JetCorrectionGrid(
+                    const std::vector<JetCorrectorParameters> &corrections,
+                    const JetCorrectorParameters *uncertainty):
+                _log_pt(64, log(5.), log(4000.)),
+                _area(7, 0, 1.5),
+                _rho(9, 0, 40)
+            {
+                const string correction_variables[] = {
+                    "JetPt", "JetA", "Rho"
+                };
+
+                bool is_supported = !corrections.empty();
+                for(std::vector<JetCorrectorParameters>::const_iterator
+                            parameters = corrections.begin();
+                        corrections.end() != parameters
+                            && is_supported;
+                        ++parameters)
+                {
+                    is_supported = isGridSupported(*parameters,
+                            correction_variables, 3);
+
+                    _correction_eta.add(*parameters);
+                }
+
+                if (is_supported)
+                    tabulate(corrections);
+                else
+                    clog << "jet energy corrections depend on variables "
+                        << "other than eta, pt, area and rho: "
+                        << "corrections are not interpolated" << endl;
+
+                if (!uncertainty)
+                    return;
+
+                const string uncertainty_variables[] = { "JetPt" };
+
+                if (isGridSupported(*uncertainty, uncertainty_variables, 1))
+                {
+                    _uncertainty_eta.add(*uncertainty);
+
+                    tabulate(*uncertainty);
+                }
+                else
+                    clog << "jet energy uncertainty depends on variables "
+                        << "other than eta and pt: "
+                        << "uncertainty is not interpolated" << endl;
+            }
+
+            // Return false if jet is outside of the grid
+            //
+            bool correction(const float &eta,
+                    const float &pt,
+                    const float &area,
+                    const float &rho,
+                    float &result) const
+            {
+                uint32_t bin;
+                uint32_t point[3];
+                float fraction[3];
+
+                if (_corrections.empty()
+                        || !_correction_eta.locate(eta, bin)
+                        || !_log_pt.locate(log(pt), point[0], fraction[0])
+                        || !_area.locate(area, point[1], fraction[1])
+                        || !_rho.locate(rho, point[2], fraction[2]))
+                    return false;
+
+                const uint32_t stride[3] = {
+                    _area.points() * _rho.points(),
+                    _rho.points(),
+                    1
+                };
+
+                result = interpolate(_corrections,
+                        bin * _log_pt.points() * stride[0],
+                        3, point, fraction, stride);
+
+                return true;
+            }
+
+            bool uncertainty(const float &eta,
+                    const float &pt,
+                    float &result) const
+            {
+                uint32_t bin;
+                uint32_t point[1];
+                float fraction[1];
+
+                if (_uncertainties.empty()
+                        || !_uncertainty_eta.locate(eta, bin)
+                        || !_log_pt.locate(log(pt), point[0], fraction[0]))
+                    return false;
+
+                const uint32_t stride[1] = { 1 };
+
+                result = interpolate(_uncertainties,
+                        bin * _log_pt.points(),
+                        1, point, fraction, stride);
+
+                return true;
+            }
+
+        private:
+            void tabulate(const std::vector<JetCorrectorParameters> &parameters)
+            {
+                FactorizedJetCorrector corrector(parameters);
+
+                _corrections.reserve(_correction_eta.bins() * _log_pt.points()
+                        * _area.points() * _rho.points());
+
+                for(uint32_t eta = 0; _correction_eta.bins() > eta; ++eta)
+                    for(uint32_t pt = 0; _log_pt.points() > pt; ++pt)
+                        for(uint32_t area = 0; _area.points() > area; ++area)
+                            for(uint32_t rho = 0; _rho.points() > rho; ++rho)
+                {
+                    const float jet_eta = _correction_eta.center(eta);
+                    const float jet_pt = exp(_log_pt.value(pt));
+
+                    // Energy and NPV are not used by the supported levels
+                    //
+                    corrector.setJetEta(jet_eta);
+                    corrector.setJetPt(jet_pt);
+                    corrector.setJetE(jet_pt * cosh(jet_eta));
+                    corrector.setNPV(0);
+                    corrector.setJetA(_area.value(area));
+                    corrector.setRho(_rho.value(rho));
+
+                    _corrections.push_back(corrector.getCorrection());
+                }
+            }
+
+            void tabulate(const JetCorrectorParameters &parameters)
+            {
+                JetCorrectionUncertainty uncertainty(parameters);
+
+                _uncertainties.reserve(_uncertainty_eta.bins()
+                        * _log_pt.points());
+
+                for(uint32_t eta = 0; _uncertainty_eta.bins() > eta; ++eta)
+                    for(uint32_t pt = 0; _log_pt.points() > pt; ++pt)
+                {
+                    uncertainty.setJetEta(_uncertainty_eta.center(eta));
+                    uncertainty.setJetPt(exp(_log_pt.value(pt)));
+
+                    _uncertainties.push_back(uncertainty.getUncertainty(true));
+                }
+            }
+
+            // Sum corners of the grid cell weighted with distance
+            //
+            float interpolate(const std::vector<float> &table,
+                    const uint32_t &origin,
+                    const uint32_t &dimensions,
+                    const uint32_t *point,
+                    const float *fraction,
+                    const uint32_t *stride) const
+            {
+                uint32_t cell = origin;
+                for(uint32_t axis = 0; dimensions > axis; ++axis)
+                    cell += point[axis] * stride[axis];
+
+                float result = 0;
+                for(uint32_t corner = 0; (1u << dimensions) > corner; ++corner)
+                {
+                    uint32_t offset = cell;
+                    float weight = 1;
+                    for(uint32_t axis = 0; dimensions > axis; ++axis)
+                    {
+                        if (corner & (1u << axis))
+                        {
+                            offset += stride[axis];
+                            weight *= fraction[axis];
+                        }
+                        else
+                            weight *= 1 - fraction[axis];
+                    }
+
+                    result += weight * table[offset];
+                }
+
+                return result;
+            }
+
+            EtaBins _correction_eta;
+            EtaBins _uncertainty_eta;
+
+            GridAxis _log_pt;
+            GridAxis _area;
+            GridAxis _rho;
+
+            std::vector<float> _corrections;
+            std::vector<float> _uncertainties;
+    };
+
+    // Grid is built by the first jet that needs it. Builder is shared by
+    // copies of the corrections and threads wait for the same grid
+    //
+    class JetCorrectionGridBuilder
+    {
+        public:
+            typedef boost::shared_ptr<const JetCorrectionGrid> GridPtr;
+            typedef boost::shared_ptr<const JetCorrectorParameters>
+                ParametersPtr;
+
+            JetCorrectionGridBuilder(
+                    const std::vector<JetCorrectorParameters> &corrections,
+                    const ParametersPtr &uncertainty):
+                _corrections(corrections),
+                _uncertainty(uncertainty)
+            {
+            }
+
+            GridPtr grid()
+            {
+                boost::mutex::scoped_lock lock(_mutex);
+
+                if (!_grid)
+                {
+                    _grid.reset(new JetCorrectionGrid(_corrections,
+                                _uncertainty.get()));
+
+                    clog << "jet energy corrections grid is built" << endl;
+                }
+
+                return _grid;
+            }
+
+        private:
+            boost::mutex _mutex;
+
+            std::vector<JetCorrectorParameters> _corrections;
+            ParametersPtr _uncertainty;
+
+            GridPtr _grid;
+    };
 }
 
-JetEnergyCorrections::JetEnergyCorrections(const JetEnergyCorrections &object)
+
+
+// Jet Energy Corrections
+//
+JetEnergyCorrections::JetEnergyCorrections():
+    _systematic_direction(0),
+    _grid_mode(NO_GRID),
+    _validated_jets(0),
+    _max_correction_deviation(0),
+    _max_uncertainty_deviation(0)
 {
-    setCorrectionFiles(object.correctionFiles());
+}
 
-    if (!object._systematic_file.empty())
-        setSystematic(0 < object._systematic_direction ? UP : DOWN,
-                object._systematic_file);
+JetEnergyCorrections::JetEnergyCorrections(const JetEnergyCorrections &object):
+    _systematic_direction(0),
+    _grid_mode(NO_GRID),
+    _validated_jets(0),
+    _max_correction_deviation(0),
+    _max_uncertainty_deviation(0)
+{
+    shareCorrections(object);
 }
 
-CorrectedJet JetEnergyCorrections::correctJet(
+bool JetEnergyCorrections::correctJet(CorrectedJet &corrected_jet,
         const Jet *jet,
         const Event *event,
         const Electrons &electrons,
         const Muons &muons,
         const LorentzVector *met)
 {
-    CorrectedJet corrected_jet;
-    corrected_jet.jet = jet;
-
     // Test if corrections are loaded
     //
     CorrectorPtr jec = corrector();
     if (!jec)
-        return corrected_jet;
+        return false;
 
     // Check if jet uncorrected energy and area are available
     //
     if (!jet->has_uncorrected_p4()
             || !jet->has_extra()
             || !jet->extra().has_area())
-        return corrected_jet;
+        return false;
 
     // Check if event RHO information is available
     //
     if (!event->has_extra()
             || !event->extra().has_rho())
-        return corrected_jet;
+        return false;
 
-    corrected_jet.corrected_p4.reset(new LorentzVector());
-    corrected_jet.corrected_p4->CopyFrom(jet->uncorrected_p4());
+    corrected_jet.reset(jet);
 
     // Remove leptons only if any were passed
     //
@@ -225,12 +638,13 @@ CorrectedJet JetEnergyCorrections::correctJet(
             || !muons.empty())
         cleanJet(corrected_jet, electrons, muons);
 
-    corrected_jet.subtracted_p4.reset(new LorentzVector());
-    corrected_jet.subtracted_p4->CopyFrom(*corrected_jet.corrected_p4);
+    corrected_jet.subtracted_p4.CopyFrom(corrected_jet.corrected_p4);
 
     correct(corrected_jet, event, met);
 
-    return corrected_jet;
+    corrected_jet.update();
+
+    return true;
 }
 
 const JetEnergyCorrections::CorrectionFiles
@@ -252,24 +666,53 @@ void JetEnergyCorrections::setCorrectionFiles(const CorrectionFiles &files)
     }
 }
 
+void JetEnergyCorrections::shareCorrections(const JetEnergyCorrections &object)
+{
+    _corrections = object._corrections;
+    _correction_files = object._correction_files;
+    _jec.reset();
+
+    _systematic_parameters = object._systematic_parameters;
+    _systematic_file = object._systematic_file;
+    _systematic_direction = object._systematic_direction;
+    _systematic.reset();
+
+    // Copies share the grid builder: grid is built only once
+    //
+    _grid_mode = object._grid_mode;
+    _grid_builder = object._grid_builder;
+    _grid = object._grid;
+}
+
 // Jet Energy Correction Delegate interface
 //
 void JetEnergyCorrections::setCorrection(const Level &jec_level,
         const std::string &file_name)
 {
-    if (_corrections.end() != _corrections.find(jec_level))
-        cerr << jec_level << " jet energy correction is already loaded" << endl;
-    else
+    if (_corrections
+            && _corrections->end() != _corrections->find(jec_level))
     {
-        _corrections[jec_level] = JetCorrectorParameters(file_name);
-        _correction_files[jec_level] = file_name;
+        cerr << jec_level << " jet energy correction is already loaded" << endl;
 
-        clog << jec_level << " loaded " << file_name << endl;
+        return;
+    }
 
-        _jec.reset();
+    // Parameters may be shared with other objects: add level to a copy
+    //
+    boost::shared_ptr<Corrections> corrections(_corrections
+            ? new Corrections(*_corrections)
+            : new Corrections());
 
-        corrector();
-    }
+    (*corrections)[jec_level] = JetCorrectorParameters(file_name);
+    _corrections = corrections;
+    _correction_files[jec_level] = file_name;
+
+    clog << jec_level << " loaded " << file_name << endl;
+
+    _jec.reset();
+    resetGrid();
+
+    corrector();
 }
 
 void JetEnergyCorrections::setSystematic(const Systematic &systematic,
@@ -280,7 +723,9 @@ void JetEnergyCorrections::setSystematic(const Systematic &systematic,
     else
     {
         _systematic_file = filename;
-        _systematic.reset(new JetCorrectionUncertainty(filename));
+        _systematic_parameters.reset(new JetCorrectorParameters(filename));
+        _systematic.reset();
+        resetGrid();
 
         clog << "systematic jet energy correction loaded " << filename << endl;
 
@@ -291,10 +736,49 @@ void JetEnergyCorrections::setSystematic(const Systematic &systematic,
     }
 }
 
+void JetEnergyCorrections::setCorrectionGrid(const bool &validate)
+{
+    _grid_mode = validate
+        ? VALIDATE_GRID
+        : GRID;
+
+    resetGrid();
+}
+
 // Object interface
 //
+void JetEnergyCorrections::merge(const ObjectPtr &pointer)
+{
+    if (pointer->id() != id())
+        return;
+
+    boost::shared_ptr<JetEnergyCorrections> object =
+        dynamic_pointer_cast<JetEnergyCorrections>(pointer);
+
+    if (!object)
+        return;
+
+    _validated_jets += object->_validated_jets;
+    _max_correction_deviation = max(_max_correction_deviation,
+            object->_max_correction_deviation);
+    _max_uncertainty_deviation = max(_max_uncertainty_deviation,
+            object->_max_uncertainty_deviation);
+
+    Object::merge(pointer);
+}
+
 void JetEnergyCorrections::print(std::ostream &out) const
 {
+    if (VALIDATE_GRID != _grid_mode)
+        return;
+
+    out << "JEC grid validation: " << _validated_jets << " jets" << endl;
+    out << " max correction relative deviation: "
+        << _max_correction_deviation << endl;
+
+    if (_systematic_parameters)
+        out << " max uncertainty deviation: "
+            << _max_uncertainty_deviation << endl;
 }
 
 // Privates
@@ -302,11 +786,12 @@ void JetEnergyCorrections::print(std::ostream &out) const
 JetEnergyCorrections::CorrectorPtr JetEnergyCorrections::corrector()
 {
     if (!_jec
-            && !_corrections.empty())
+            && _corrections
+            && !_corrections->empty())
     {
         vector<JetCorrectorParameters> corrections;
-        for(Corrections::const_iterator correction = _corrections.begin();
-                _corrections.end() != correction;
+        for(Corrections::const_iterator correction = _corrections->begin();
+                _corrections->end() != correction;
                 ++correction)
         {
             corrections.push_back(correction->second);
@@ -318,39 +803,131 @@ JetEnergyCorrections::CorrectorPtr JetEnergyCorrections::corrector()
     return _jec;
 }
 
+JetEnergyCorrections::GridPtr JetEnergyCorrections::grid()
+{
+    if (!_grid
+            && _grid_builder)
+        _grid = _grid_builder->grid();
+
+    return _grid;
+}
+
+void JetEnergyCorrections::resetGrid()
+{
+    _grid.reset();
+    _grid_builder.reset();
+
+    if (NO_GRID == _grid_mode
+            || !_corrections
+            || _corrections->empty())
+        return;
+
+    vector<JetCorrectorParameters> corrections;
+    for(Corrections::const_iterator correction = _corrections->begin();
+            _corrections->end() != correction;
+            ++correction)
+    {
+        corrections.push_back(correction->second);
+    }
+
+    _grid_builder.reset(new JetCorrectionGridBuilder(corrections,
+                _systematic_parameters));
+}
+
+JetEnergyCorrections::SystematicPtr JetEnergyCorrections::systematic()
+{
+    if (!_systematic
+            && _systematic_parameters)
+    {
+        _systematic.reset(
+                new JetCorrectionUncertainty(*_systematic_parameters));
+    }
+
+    return _systematic;
+}
+
 void JetEnergyCorrections::correct(CorrectedJet &jet,
         const Event *event,
         const LorentzVector *met)
 {
     CorrectorPtr jec = corrector();
 
-    // Correct jet Lorentz Vector
+    const float jet_eta = eta(jet.corrected_p4);
+    const float jet_pt = pt(jet.corrected_p4);
+    const float jet_area = jet.jet->extra().area();
+    const float rho = event->extra().rho();
+
+    // Use grid if jet is inside it, exact corrector otherwise
     //
-    jec->setJetEta(eta(*jet.corrected_p4));
-    jec->setJetPt(pt(*jet.corrected_p4));
-    jec->setJetE(jet.corrected_p4->e());
-    jec->setNPV(event->primary_vertex().size());
-    jec->setJetA(jet.jet->extra().area());
-    jec->setRho(event->extra().rho());
+    GridPtr correction_grid = NO_GRID == _grid_mode
+        ? GridPtr()
+        : grid();
+
+    bool is_grid_correction = correction_grid
+        && correction_grid->correction(jet_eta, jet_pt, jet_area, rho,
+                jet.correction);
 
-    jet.correction = jec->getCorrection();
+    if (!is_grid_correction
+            || VALIDATE_GRID == _grid_mode)
+    {
+        // Correct jet Lorentz Vector
+        //
+        jec->setJetEta(jet_eta);
+        jec->setJetPt(jet_pt);
+        jec->setJetE(jet.corrected_p4.e());
+        jec->setNPV(event->primary_vertex().size());
+        jec->setJetA(jet_area);
+        jec->setRho(rho);
 
-    *jet.corrected_p4 *= jet.correction;
+        const float correction = jec->getCorrection();
 
-    jet.corrected_met.reset(new LorentzVector());
-    jet.corrected_met->CopyFrom(*met);
+        if (is_grid_correction)
+        {
+            ++_validated_jets;
+
+            if (correction)
+                _max_correction_deviation = max(_max_correction_deviation,
+                        fabs(jet.correction - correction) / correction);
+        }
+        else
+            jet.correction = correction;
+    }
+
+    jet.corrected_p4 *= jet.correction;
+
+    jet.corrected_met.CopyFrom(*met);
 
     // Apply systematics if any
     //
-    if (_systematic)
+    if (SystematicPtr jes_systematic = systematic())
     {
-        _systematic->setJetPt(pt(*jet.corrected_p4));
-        _systematic->setJetEta(eta(*jet.corrected_p4));
+        const float corrected_pt = pt(jet.corrected_p4);
+        const float corrected_eta = eta(jet.corrected_p4);
+
+        float uncertainty = 0;
+        const bool is_grid_uncertainty = correction_grid
+            && correction_grid->uncertainty(corrected_eta, corrected_pt,
+                    uncertainty);
+
+        if (!is_grid_uncertainty
+                || VALIDATE_GRID == _grid_mode)
+        {
+            jes_systematic->setJetPt(corrected_pt);
+            jes_systematic->setJetEta(corrected_eta);
+
+            const float exact_uncertainty =
+                jes_systematic->getUncertainty(true);
+
+            if (is_grid_uncertainty)
+                _max_uncertainty_deviation = max(_max_uncertainty_deviation,
+                        fabs(uncertainty - exact_uncertainty));
+            else
+                uncertainty = exact_uncertainty;
+        }
 
-        const float jes = 1.
-            + _systematic_direction * _systematic->getUncertainty(true);
+        const float jes = 1. + _systematic_direction * uncertainty;
 
-        *jet.corrected_p4 *= jes;
+        jet.corrected_p4 *= jes;
 
         // Propagate JES to Missing EnergyMET
         //
@@ -360,13 +937,13 @@ void JetEnergyCorrections::correct(CorrectedJet &jet,
         p4.CopyFrom(jet.jet->uncorrected_p4());
         p4.set_e(0);
         p4.set_pz(0);
-        *jet.corrected_met += p4;
+        jet.corrected_met += p4;
 
         p4.CopyFrom(jet.jet->uncorrected_p4());
         p4 *= jes;
         p4.set_e(0);
         p4.set_pz(0);
-        *jet.corrected_met -= p4;
+        jet.corrected_met -= p4;
     }
 }
 
@@ -390,7 +967,7 @@ void DeltaRJetEnergyCorrections::cleanJet(CorrectedJet &corrected_jet,
             (*electron)->physics_object().p4();
         if (0.5 > dr(electron_p4, jet_p4))
         {
-            *corrected_jet.corrected_p4 -= electron_p4;
+            corrected_jet.corrected_p4 -= electron_p4;
             corrected_jet.subtracted_electrons.push_back(*electron);
         }
     }
@@ -404,7 +981,7 @@ void DeltaRJetEnergyCorrections::cleanJet(CorrectedJet &corrected_jet,
         const LorentzVector &muon_p4 = (*muon)->physics_object().p4();
         if (0.5 > dr(muon_p4, jet_p4))
         {
-            *corrected_jet.corrected_p4 -= muon_p4;
+            corrected_jet.corrected_p4 -= muon_p4;
             corrected_jet.subtracted_muons.push_back(*muon);
         }
     }
@@ -447,7 +1024,7 @@ void ChildJetEnergyCorrections::cleanJet(CorrectedJet &corrected_jet,
                 (*electron)->physics_object().p4();
             if (electron_p4 == child_p4)
             {
-                *corrected_jet.corrected_p4 -= electron_p4;
+                corrected_jet.corrected_p4 -= electron_p4;
                 corrected_jet.subtracted_electrons.push_back(*electron);
             }
         }
@@ -461,7 +1038,7 @@ void ChildJetEnergyCorrections::cleanJet(CorrectedJet &corrected_jet,
             const LorentzVector &muon_p4 = (*muon)->physics_object().p4();
             if (muon_p4 == child_p4)
             {
-                *corrected_jet.corrected_p4 -= muon_p4;
+                corrected_jet.corrected_p4 -= muon_p4;
                 corrected_jet.subtracted_muons.push_back(*muon);
             }
         }
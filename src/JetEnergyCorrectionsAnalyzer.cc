@@ -117,10 +117,10 @@ void JetEnergyCorrectionsAnalyzer::setChildCorrection()
 {
     // there is not guarantee that --child-corrrection argument is used before
     // any level of the jet energy corrections file is specified. Therefore,
-    // files should be reloaded with ne object.
+    // loaded corrections are shared with new object.
     //
     shared_ptr<JetEnergyCorrections> jec(new ChildJetEnergyCorrections());
-    jec->setCorrectionFiles(_jec->correctionFiles());
+    jec->shareCorrections(*_jec);
 
     // Activate new Jet Energy Corrections
     //
@@ -204,6 +204,8 @@ void JetEnergyCorrectionsAnalyzer::jets(const Event *event)
     LockSelectorEventCounterOnUpdate lock(*_jet_selector);
     uint32_t id = 1;
     const LorentzVector *met = &(event->missing_energy().p4());
+    LorentzVector corrected_met;
+    CorrectedJet correction;
     for(Jets::const_iterator jet = event->jet().begin();
             event->jet().end() != jet;
             ++jet, ++id)
@@ -219,17 +221,17 @@ void JetEnergyCorrectionsAnalyzer::jets(const Event *event)
             const LorentzVector &uncorrected_p4 = jet->uncorrected_p4();
             _jet_uncorrected_p4->fill(uncorrected_p4);
 
-            CorrectedJet correction =
-                _jec->correctJet(&*jet, event, electrons, muons, met);
-            if (!correction.corrected_p4)
+            if (!_jec->correctJet(correction,
+                        &*jet, event, electrons, muons, met))
                 continue;
 
-            met = correction.corrected_met.get();
+            corrected_met.CopyFrom(correction.corrected_met);
+            met = &corrected_met;
 
-            LorentzVectorPtr corrected_p4 = correction.corrected_p4;
-            LorentzVectorPtr subtracted_p4 = correction.subtracted_p4;
+            const LorentzVector &corrected_p4 = correction.corrected_p4;
+            const LorentzVector &subtracted_p4 = correction.subtracted_p4;
 
-            _jet_offline_corrected_p4->fill(*corrected_p4);
+            _jet_offline_corrected_p4->fill(corrected_p4);
 
             _out << "[" << setw(2) << right << id << "]"
                 << endl;
@@ -251,14 +253,14 @@ void JetEnergyCorrectionsAnalyzer::jets(const Event *event)
 
             _out << setw(5) << " "
                 << " Subtracted "
-                << "pT: " << pt(*subtracted_p4)
-                << " eta: " << eta(*subtracted_p4)
+                << "pT: " << pt(subtracted_p4)
+                << " eta: " << eta(subtracted_p4)
                 << endl;
 
             _out << setw(5) << " "
                 << "Offline JEC "
-                << "pT: " << pt(*corrected_p4)
-                << " eta: " << eta(*corrected_p4)
+                << "pT: " << pt(corrected_p4)
+                << " eta: " << eta(corrected_p4)
                 << endl;
 
             shared_ptr<Format> format(new FullFormat());
@@ -59,10 +59,22 @@ void JetEnergyResolutionOptions::setSystematic(
 JetEnergyResolution::JetEnergyResolution():
     _systematic(NONE)
 {
+    const float edges[] = { 0, 0.5, 1.1, 1.7, 2.3, 5 };
+
+    _scales = LookupTable(LookupAxis(vector<float>(edges, edges + 6)));
+
+    const float nominal[] = { 0.052, 0.057, 0.096, 0.134, 0.288 };
+    const float up[] = { 0.115, 0.114, 0.161, 0.228, 0.488 };
+    const float down[] = { -0.01, 0., 0.032, 0.042, 0.089 };
+
+    _scales.set(LookupTable::NOMINAL, vector<float>(nominal, nominal + 5));
+    _scales.set(LookupTable::UP, vector<float>(up, up + 5));
+    _scales.set(LookupTable::DOWN, vector<float>(down, down + 5));
 }
 
 JetEnergyResolution::JetEnergyResolution(const JetEnergyResolution &obj):
-    _systematic(obj._systematic)
+    _systematic(obj._systematic),
+    _scales(obj._scales)
 {
 }
 
@@ -74,12 +86,13 @@ void JetEnergyResolution::correct(CorrectedJet &jet)
         return;
 
     const float gen_pt = pt(jet.jet->gen_parton().physics_object().p4());
-    const float reco_pt = pt(*jet.corrected_p4);
+    const float reco_pt = jet.corrected_pt;
 
-    const float pt_scale = max(0.f, 1 + scale(eta(*jet.corrected_p4)) * 
+    const float pt_scale = max(0.f, 1 + scale(jet.corrected_eta) * 
                                         (reco_pt - gen_pt) / reco_pt);
 
-    *jet.corrected_p4 *= pt_scale;
+    jet.corrected_p4 *= pt_scale;
+    jet.update();
 }
 
 // JetEnergyResolutionDelegate interface
@@ -112,49 +125,13 @@ float JetEnergyResolution::scale(const float &reco_eta)
     switch(_systematic)
     {
         case NONE:
-            if (0.5 > reco_eta)
-                return 0.052;
-
-            if (1.1 > reco_eta)
-                return 0.057;
-
-            if (1.7 > reco_eta)
-                return 0.096;
-
-            if (2.3 > reco_eta)
-                return 0.134;
-
-            return 0.288;
+            return _scales.value(reco_eta, LookupTable::NOMINAL);
 
         case UP:
-            if (0.5 > reco_eta)
-                return 0.115;
-
-            if (1.1 > reco_eta)
-                return 0.114;
-
-            if (1.7 > reco_eta)
-                return 0.161;
-
-            if (2.3 > reco_eta)
-                return 0.228;
-
-            return 0.488;
+            return _scales.value(reco_eta, LookupTable::UP);
 
         case DOWN:
-            if (0.5 > reco_eta)
-                return -0.01;
-
-            if (1.1 > reco_eta)
-                return 0.;
-
-            if (1.7 > reco_eta)
-                return 0.032;
-
-            if (2.3 > reco_eta)
-                return 0.042;
-
-            return 0.089;
+            return _scales.value(reco_eta, LookupTable::DOWN);
 
         default:
             throw runtime_error("unsupported jet energy resolution systematic");
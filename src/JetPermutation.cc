@@ -5,42 +5,108 @@
 
 #include <stdexcept>
 
-#include "bsm_stat/interface/Number.h"
-#include "bsm_stat/interface/Permutation.h"
 #include "interface/JetPermutation.h"
 
 using namespace std;
 
 using bsm::JetPermutation;
+using bsm::JetPermutationTable;
 
-JetPermutation::JetPermutation():
-    _flip_combination(false)
+// Jet Permutation Table
+//
+const JetPermutationTable JetPermutationTable::_instance;
+
+const JetPermutationTable &JetPermutationTable::instance()
 {
-    _prime_generator.reset(new stat::PrimeNumber());
-    _jets = 0;
+    return _instance;
 }
 
-void JetPermutation::init(const Jets &jets)
+uint32_t JetPermutationTable::combinations(const uint32_t &jets) const
 {
-    _jets = &jets;
+    if (MAX_JETS < jets)
+        throw out_of_range("too many jets for permutations");
 
-    _flip_combination = false;
+    return _sizes[jets];
+}
+
+const JetPermutationTable::Combination *JetPermutationTable::begin() const
+{
+    return &_combinations[0];
+}
 
-    // Test if permutations exist
+JetPermutationTable::Indices JetPermutationTable::indices(const Mask &mask) const
+{
+    return Indices(&_indices[0] + _offsets[mask],
+                   &_indices[0] + _offsets[mask + 1]);
+}
+
+// Private
+//
+JetPermutationTable::JetPermutationTable()
+{
+    // Every unordered pair is stored once: the highest used jet is always
+    // in the right subset. Jets below it are either unused, left or right
     //
-    PermutationTables::const_iterator current_table =
-        _permutation_tables.find(jets.size());
-    if (_permutation_tables.end() == current_table)
+    _sizes.assign(2, 0);
+    for(uint32_t last = 1; MAX_JETS > last; ++last)
     {
-        // permutations do not exist: generate these
-        //
-        generatePermutations(jets.size());
+        const Mask all = (1u << last) - 1;
+
+        for(Mask left = 1; all >= left; ++left)
+        {
+            const Mask rest = all & ~left;
+
+            for(Mask right = rest; ; right = (right - 1) & rest)
+            {
+                Combination combination;
+                combination.left = left;
+                combination.right = right | (1u << last);
+
+                _combinations.push_back(combination);
+
+                if (!right)
+                    break;
+            }
+        }
+
+        _sizes.push_back(_combinations.size());
     }
-    else
+
+    // Indices of all subsets
+    //
+    _offsets.reserve((1u << MAX_JETS) + 1);
+    for(Mask mask = 0; (1u << MAX_JETS) > mask; ++mask)
     {
-        _current_permutation = current_table->second.begin();
-        _end_permutation = current_table->second.end();
+        _offsets.push_back(_indices.size());
+
+        for(uint8_t jet = 0; MAX_JETS > jet; ++jet)
+        {
+            if (mask & (1u << jet))
+                _indices.push_back(jet);
+        }
     }
+    _offsets.push_back(_indices.size());
+}
+
+
+
+// Jet Permutation
+//
+JetPermutation::JetPermutation():
+    _current_permutation(0),
+    _end_permutation(0),
+    _flip_combination(false)
+{
+}
+
+void JetPermutation::init(const Jets &jets)
+{
+    const JetPermutationTable &table = JetPermutationTable::instance();
+
+    _current_permutation = table.begin();
+    _end_permutation = _current_permutation + table.combinations(jets.size());
+
+    _flip_combination = false;
 }
 
 bool JetPermutation::next()
@@ -55,133 +121,38 @@ bool JetPermutation::next()
     return _end_permutation != ++_current_permutation;
 }
 
-JetPermutation::Jets JetPermutation::leptonicJets()
+JetPermutation::Mask JetPermutation::leptonicMask() const
 {
-    if (!_jets)
+    if (!_end_permutation)
         throw runtime_error("jet permutations are not initialized");
 
     if (_end_permutation == _current_permutation)
-        return Jets();
+        return 0;
 
-    return jets(_flip_combination
-            ? _current_permutation->right
-            : _current_permutation->left);
+    return _flip_combination
+        ? _current_permutation->right
+        : _current_permutation->left;
 }
 
-JetPermutation::Jets JetPermutation::hadronicJets()
+JetPermutation::Mask JetPermutation::hadronicMask() const
 {
-    if (!_jets)
+    if (!_end_permutation)
         throw runtime_error("jet permutations are not initialized");
 
     if (_end_permutation == _current_permutation)
-        return Jets();
-
-    return jets(_flip_combination
-            ? _current_permutation->left
-            : _current_permutation->right);
-}
-
-// Private
-//
-JetPermutation::Jets JetPermutation::jets(uint64_t product)
-{
-    Jets jets;
-
-    while(1 != product)
-    {
-        for(PrimeIDs::const_iterator prime = _prime_id.begin();
-                _prime_id.end() != prime;
-                ++prime)
-        {
-            if (0 == product % prime->first)
-            {
-                product /= prime->first;
-
-                jets.push_back((*_jets)[prime->second]);
-
-                break;
-            }
-        }
-    }
+        return 0;
 
-    return jets;
+    return _flip_combination
+        ? _current_permutation->left
+        : _current_permutation->right;
 }
 
-void JetPermutation::generatePermutations(const uint32_t &size)
+JetPermutation::Indices JetPermutation::leptonic() const
 {
-    expandPrimeIDs(size);
-
-    // Prepare vector of primes for permutator
-    //
-    typedef vector<uint32_t> Primes;
-    Primes primes;
-    {
-        uint32_t i = 0;
-        for(PrimeIDs::const_iterator prime = _prime_id.begin();
-                size > i;
-                ++prime, ++i)
-        {
-            primes.push_back(prime->first);
-        }
-    }
-
-    Permutations &permutations = _permutation_tables[size];
-
-    // Generate all possible permutations
-    //
-    typedef stat::Permutation<uint32_t> PermutationUInt;
-    typedef PermutationUInt::ObjectIterators ObjectIterators;
-
-    for(uint32_t sub_size = 2; size >= sub_size; ++sub_size)
-    {
-        PermutationUInt permutator(primes, sub_size);
-        do
-        {
-            // Get current permutation, move the saparator from left to right,
-            // calculate the product of left and right prime numbers, store
-            // in table if unique (combination is assumed to be the same if
-            // left and right products are swapped: this swap should be taken
-            // into account later when pair is used
-            //
-            const ObjectIterators &iterators = permutator.objectIterators();
-            for(uint32_t separation = 1; sub_size > separation; ++separation)
-            {
-                // Calculate products
-                //
-                Combination combo;
-                uint32_t i = 0;
-                for(ObjectIterators::const_iterator iter = iterators.begin();
-                        iterators.end() != iter;
-                        ++iter, ++i)
-                {
-                    if (separation > i)
-                        combo.left *= *(*iter);
-                    else
-                        combo.right *= *(*iter);
-                }
-
-                if (permutations.end() != find(permutations.begin(),
-                            permutations.end(),
-                            combo))
-                    continue;
-
-                permutations.push_back(combo);
-            }
-        }
-        while(permutator.next());
-    }
-
-    _current_permutation = permutations.begin();
-    _end_permutation = permutations.end();
+    return JetPermutationTable::instance().indices(leptonicMask());
 }
 
-void JetPermutation::expandPrimeIDs(const uint32_t &size)
+JetPermutation::Indices JetPermutation::hadronic() const
 {
-    // Expand list of primary numbers
-    //
-    for(uint32_t i = _prime_id.size(); size > i; ++i)
-    {
-        _prime_id[*_prime_generator] = i;
-        _prime_generator->next();
-    }
+    return JetPermutationTable::instance().indices(hadronicMask());
 }
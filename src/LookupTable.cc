@@ -0,0 +1,234 @@
+// Flat binned lookup table for weights and scale factors
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <TH1.h>
+
+#include "interface/LookupTable.h"
+
+using namespace bsm;
+using namespace std;
+
+// Lookup Axis
+//
+LookupAxis::LookupAxis():
+    _bins(1),
+    _last_bin(0),
+    _min(0),
+    _max(0),
+    _scale(0),
+    _edge(LOWER_INCLUSIVE)
+{
+}
+
+LookupAxis::LookupAxis(const uint32_t &bins, const float &min, const float &max):
+    _bins(bins),
+    _last_bin(bins - 1),
+    _min(min),
+    _max(max),
+    _scale(bins / (max - min)),
+    _edge(LOWER_INCLUSIVE)
+{
+    if (!bins || min >= max)
+        throw invalid_argument("lookup axis: bad uniform binning");
+}
+
+LookupAxis::LookupAxis(const vector<float> &edges, const Edge &edge):
+    _min(0),
+    _max(0),
+    _scale(0),
+    _edge(edge)
+{
+    if (2 > edges.size())
+        throw invalid_argument("lookup axis: at least two edges are needed");
+
+    for(vector<float>::const_iterator edge = edges.begin() + 1;
+            edges.end() != edge;
+            ++edge)
+    {
+        if (*edge <= *(edge - 1))
+            throw invalid_argument("lookup axis: edges are not increasing");
+    }
+
+    _bins = edges.size() - 1;
+    _last_bin = _bins - 1;
+
+    // Keep inner edges only
+    //
+    _edges.assign(edges.begin() + 1, edges.end() - 1);
+}
+
+
+
+// Lookup Table
+//
+LookupTable::LookupTable():
+    _planes(0)
+{
+}
+
+LookupTable::LookupTable(const LookupAxis &x):
+    _planes(0)
+{
+    _axes.push_back(x);
+
+    init();
+}
+
+LookupTable::LookupTable(const LookupAxis &x, const LookupAxis &y):
+    _planes(0)
+{
+    _axes.push_back(x);
+    _axes.push_back(y);
+
+    init();
+}
+
+LookupTable::LookupTable(const LookupAxis &x,
+        const LookupAxis &y,
+        const LookupAxis &z):
+    _planes(0)
+{
+    _axes.push_back(x);
+    _axes.push_back(y);
+    _axes.push_back(z);
+
+    init();
+}
+
+uint32_t LookupTable::bins() const
+{
+    return _values.size() / PLANES;
+}
+
+void LookupTable::set(const Plane &plane, const vector<float> &values)
+{
+    if (values.size() != bins())
+        throw invalid_argument("lookup table: number of values does not "
+                "match number of bins");
+
+    for(uint32_t bin = 0, bins = values.size(); bins > bin; ++bin)
+        _values[bin * PLANES + plane] = values[bin];
+
+    _planes |= 1 << plane;
+}
+
+bool LookupTable::load(const Plane &plane, const TH1 *hist, const int &first_bin)
+{
+    if (!hist)
+    {
+        cerr << "lookup table: histogram is not available" << endl;
+
+        return false;
+    }
+
+    const int hist_bins[] = {
+        hist->GetNbinsX(), hist->GetNbinsY(), hist->GetNbinsZ()
+    };
+
+    uint32_t table_bins[] = { 1, 1, 1 };
+    for(uint32_t axis = 0; dimension() > axis; ++axis)
+    {
+        table_bins[axis] = _axes[axis].bins();
+
+        if (static_cast<int>(table_bins[axis]) + first_bin - 1 > hist_bins[axis])
+        {
+            cerr << "lookup table: histogram " << hist->GetName()
+                << " has too few bins along axis " << axis << endl;
+
+            return false;
+        }
+    }
+
+    // Unused axes are read at bin 0 which is what ROOT expects for lower
+    // dimension histograms
+    //
+    const int offset[] = {
+        first_bin,
+        1 < dimension() ? first_bin : 0,
+        2 < dimension() ? first_bin : 0
+    };
+
+    vector<float> values;
+    values.reserve(bins());
+    for(uint32_t x = 0; table_bins[0] > x; ++x)
+        for(uint32_t y = 0; table_bins[1] > y; ++y)
+            for(uint32_t z = 0; table_bins[2] > z; ++z)
+                values.push_back(hist->GetBinContent(x + offset[0],
+                            y + offset[1],
+                            z + offset[2]));
+
+    set(plane, values);
+
+    return true;
+}
+
+bool LookupTable::load(const Plane &plane, istream &in)
+{
+    vector<float> values;
+    values.reserve(bins());
+
+    for(string line; getline(in, line); )
+    {
+        if (line.empty() || '#' == line[0])
+            continue;
+
+        istringstream tokens(line);
+        for(float value; tokens >> value; )
+            values.push_back(value);
+
+        if (!tokens.eof())
+        {
+            cerr << "lookup table: failed to parse line: " << line << endl;
+
+            return false;
+        }
+    }
+
+    if (values.size() != bins())
+    {
+        cerr << "lookup table: expected " << bins() << " values, read "
+            << values.size() << endl;
+
+        return false;
+    }
+
+    set(plane, values);
+
+    return true;
+}
+
+bool LookupTable::load(const Plane &plane, const string &filename)
+{
+    ifstream in(filename.c_str());
+    if (!in.is_open())
+    {
+        cerr << "failed to open lookup table file: " << filename << endl;
+
+        return false;
+    }
+
+    return load(plane, in);
+}
+
+// Private
+//
+void LookupTable::init()
+{
+    _strides.assign(_axes.size(), 1);
+
+    uint32_t bins = 1;
+    for(int axis = _axes.size() - 1; 0 <= axis; --axis)
+    {
+        _strides[axis] = bins;
+        bins *= _axes[axis].bins();
+    }
+
+    _values.assign(bins * PLANES, 0);
+}
@@ -1,13 +1,17 @@
 // A collection of Monitors
 //
 // Monitors are used to easily check different quantities, physics objects,
-// jets, etc.
+// jets, etc. Streaming summaries (moments and quantiles) of the monitored
+// quantities are kept once enableSummaries() is called and are printed
+// next to histograms
 //
 // Created by Samvel Khalatyan, Apr 22, 2011
 // Copyright 2011, All rights reserved
 
 #include <iomanip>
 #include <ostream>
+#include <string>
+#include <utility>
 
 #include "bsm_core/interface/ID.h"
 #include "bsm_input/interface/Algebra.h"
@@ -40,6 +44,20 @@ using bsm::stat::H2;
 
 using bsm::H1Ptr;
 using bsm::H2Ptr;
+using bsm::NamedSummaries;
+
+namespace
+{
+    // Histograms without summary are skipped
+    //
+    void addSummary(NamedSummaries &summaries,
+            const std::string &name,
+            const bsm::H1ProxyPtr &histogram)
+    {
+        if (histogram->summary())
+            summaries.push_back(std::make_pair(name, histogram->summary()));
+    }
+}
 
 // Delta Monitor
 //
@@ -77,17 +95,39 @@ DeltaMonitor::DeltaMonitor(const DeltaMonitor &object)
     monitor(_ptrel_vs_r);
 }
 
+void DeltaMonitor::enableSummaries()
+{
+    _r->enableSummary();
+    _eta->enableSummary();
+    _phi->enableSummary();
+    _ptrel->enableSummary();
+    _angle->enableSummary();
+}
+
+NamedSummaries DeltaMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "dr", _r);
+    addSummary(summaries, "deta", _eta);
+    addSummary(summaries, "dphi", _phi);
+    addSummary(summaries, "ptrel", _ptrel);
+    addSummary(summaries, "angle", _angle);
+
+    return summaries;
+}
+
 void DeltaMonitor::fill(const LorentzVector &p1,
                         const LorentzVector &p2,
                         const float &weight)
 {
-    r()->fill(dr(p1, p2), weight);
-    eta()->fill(bsm::eta(p1) - bsm::eta(p2), weight);
-    phi()->fill(dphi(p1, p2), weight);
-    ptrel()->fill(bsm::ptrel(p1, p2), weight);
-    angle()->fill(bsm::angle(p1, p2), weight);
+    _r->fill(dr(p1, p2), weight);
+    _eta->fill(bsm::eta(p1) - bsm::eta(p2), weight);
+    _phi->fill(dphi(p1, p2), weight);
+    _ptrel->fill(bsm::ptrel(p1, p2), weight);
+    _angle->fill(bsm::angle(p1, p2), weight);
 
-    ptrel_vs_r()->fill(bsm::ptrel(p1, p2), dr(p1, p2), weight);
+    _ptrel_vs_r->fill(bsm::ptrel(p1, p2), dr(p1, p2), weight);
 }
 
 const H1Ptr DeltaMonitor::r() const
@@ -132,12 +172,12 @@ DeltaMonitor::ObjectPtr DeltaMonitor::clone() const
 
 void DeltaMonitor::print(std::ostream &out) const
 {
-    out << setw(15) << left << " [R]" << *r() << endl;
-    out << setw(15) << left << " [eta]" << *eta() << endl;
-    out << setw(15) << left << " [phi] " << *phi() << endl;
-    out << setw(15) << left << " [pTrel]" << *ptrel() << endl;
-    out << setw(15) << left << " [angle]" << *angle() << endl;
-    out << setw(14) << left << " [pTrel vs R]" << *ptrel_vs_r();
+    out << setw(15) << left << " [R]" << *_r << endl;
+    out << setw(15) << left << " [eta]" << *_eta << endl;
+    out << setw(15) << left << " [phi] " << *_phi << endl;
+    out << setw(15) << left << " [pTrel]" << *_ptrel << endl;
+    out << setw(15) << left << " [angle]" << *_angle << endl;
+    out << setw(14) << left << " [pTrel vs R]" << *_ptrel_vs_r;
 }
 
 
@@ -166,9 +206,27 @@ ElectronsMonitor::ElectronsMonitor(const ElectronsMonitor &object)
     monitor(_leading_pt);
 }
 
+void ElectronsMonitor::enableSummaries()
+{
+    _multiplicity->enableSummary();
+    _pt->enableSummary();
+    _leading_pt->enableSummary();
+}
+
+NamedSummaries ElectronsMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "multiplicity", _multiplicity);
+    addSummary(summaries, "pt", _pt);
+    addSummary(summaries, "leading_pt", _leading_pt);
+
+    return summaries;
+}
+
 void ElectronsMonitor::fill(const Electrons &electrons, const float &weight)
 {
-    multiplicity()->fill(electrons.size(), weight);
+    _multiplicity->fill(electrons.size(), weight);
 
     float max_el_pt = 0;
     float el_pt = 0;
@@ -178,7 +236,7 @@ void ElectronsMonitor::fill(const Electrons &electrons, const float &weight)
     {
         el_pt = bsm::pt(electron->physics_object().p4());
 
-        pt()->fill(el_pt, weight);
+        _pt->fill(el_pt, weight);
 
         if (el_pt <= max_el_pt)
             continue;
@@ -187,7 +245,7 @@ void ElectronsMonitor::fill(const Electrons &electrons, const float &weight)
     }
 
     if (max_el_pt)
-        leading_pt()->fill(max_el_pt, weight);
+        _leading_pt->fill(max_el_pt, weight);
 }
 
 const H1Ptr ElectronsMonitor::multiplicity() const
@@ -217,9 +275,9 @@ ElectronsMonitor::ObjectPtr ElectronsMonitor::clone() const
 
 void ElectronsMonitor::print(std::ostream &out) const
 {
-    out << setw(16) << left << " [multiplicity]" << *multiplicity() << endl;
-    out << setw(16) << left << " [pt]" << *pt() << endl;
-    out << setw(16) << left << " [leading pt] " << *leading_pt();
+    out << setw(16) << left << " [multiplicity]" << *_multiplicity << endl;
+    out << setw(16) << left << " [pt]" << *_pt << endl;
+    out << setw(16) << left << " [leading pt] " << *_leading_pt;
 }
 
 
@@ -260,9 +318,33 @@ JetsMonitor::JetsMonitor(const JetsMonitor &object)
     monitor(_children);
 }
 
+void JetsMonitor::enableSummaries()
+{
+    _multiplicity->enableSummary();
+    _pt->enableSummary();
+    _uncorrected_pt->enableSummary();
+    _leading_pt->enableSummary();
+    _leading_uncorrected_pt->enableSummary();
+    _children->enableSummary();
+}
+
+NamedSummaries JetsMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "multiplicity", _multiplicity);
+    addSummary(summaries, "pt", _pt);
+    addSummary(summaries, "uncorrected_pt", _uncorrected_pt);
+    addSummary(summaries, "leading_pt", _leading_pt);
+    addSummary(summaries, "leading_uncorrected_pt", _leading_uncorrected_pt);
+    addSummary(summaries, "children", _children);
+
+    return summaries;
+}
+
 void JetsMonitor::fill(const Jets &jets, const float &weight)
 {
-    multiplicity()->fill(jets.size(), weight);
+    _multiplicity->fill(jets.size(), weight);
 
     float max_jet_pt = 0;
     float max_jet_uncorrected_pt = 0;
@@ -272,18 +354,18 @@ void JetsMonitor::fill(const Jets &jets, const float &weight)
             jets.end() != jet;
             ++jet)
     {
-        children()->fill(jet->child().size(), weight);
+        _children->fill(jet->child().size(), weight);
 
         jet_pt = bsm::pt(jet->physics_object().p4());
         jet_uncorrected_pt = 0;
 
-        pt()->fill(jet_pt, weight);
+        _pt->fill(jet_pt, weight);
 
         if (jet->has_uncorrected_p4())
         {
             jet_uncorrected_pt = bsm::pt(jet->uncorrected_p4());
 
-            uncorrected_pt()->fill(jet_uncorrected_pt, weight);
+            _uncorrected_pt->fill(jet_uncorrected_pt, weight);
         }
 
         if (jet_pt <= max_jet_pt)
@@ -295,8 +377,8 @@ void JetsMonitor::fill(const Jets &jets, const float &weight)
 
     if (max_jet_pt)
     {
-        leading_pt()->fill(max_jet_pt);
-        leading_uncorrected_pt()->fill(max_jet_uncorrected_pt, weight);
+        _leading_pt->fill(max_jet_pt);
+        _leading_uncorrected_pt->fill(max_jet_uncorrected_pt, weight);
     }
 }
 
@@ -343,14 +425,14 @@ JetsMonitor::ObjectPtr JetsMonitor::clone() const
 void JetsMonitor::print(std::ostream &out) const
 {
     out << setw(16) << left << " [multiplicity]"
-        << *multiplicity() << endl;
-    out << setw(16) << left << " [pt]" << *pt() << endl;
-    out << setw(16) << left << " [uncorrected pt]" << *uncorrected_pt() << endl;
-    out << setw(16) << left << " [leading uncorrected pt] " << *leading_uncorrected_pt()
+        << *_multiplicity << endl;
+    out << setw(16) << left << " [pt]" << *_pt << endl;
+    out << setw(16) << left << " [uncorrected pt]" << *_uncorrected_pt << endl;
+    out << setw(16) << left << " [leading uncorrected pt] " << *_leading_uncorrected_pt
         << endl;
-    out << setw(16) << left << " [leading pt] " << *leading_pt()
+    out << setw(16) << left << " [leading pt] " << *_leading_pt
         << endl;
-    out << setw(16) << left << " [children]" << *children();
+    out << setw(16) << left << " [children]" << *_children;
 }
 
 
@@ -407,20 +489,52 @@ P4Monitor::P4Monitor(const P4Monitor &object)
     monitor(_et);
 }
 
+void P4Monitor::enableSummaries()
+{
+    _energy->enableSummary();
+    _px->enableSummary();
+    _py->enableSummary();
+    _pz->enableSummary();
+    _pt->enableSummary();
+    _eta->enableSummary();
+    _phi->enableSummary();
+    _mass->enableSummary();
+    _mt->enableSummary();
+    _et->enableSummary();
+}
+
+NamedSummaries P4Monitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "energy", _energy);
+    addSummary(summaries, "px", _px);
+    addSummary(summaries, "py", _py);
+    addSummary(summaries, "pz", _pz);
+    addSummary(summaries, "pt", _pt);
+    addSummary(summaries, "eta", _eta);
+    addSummary(summaries, "phi", _phi);
+    addSummary(summaries, "mass", _mass);
+    addSummary(summaries, "mt", _mt);
+    addSummary(summaries, "et", _et);
+
+    return summaries;
+}
+
 void P4Monitor::fill(const LorentzVector &p4, const float &weight)
 {
-    energy()->fill(p4.e(), weight);
-    px()->fill(p4.px(), weight);
-    py()->fill(p4.py(), weight);
-    pz()->fill(p4.pz(), weight);
+    _energy->fill(p4.e(), weight);
+    _px->fill(p4.px(), weight);
+    _py->fill(p4.py(), weight);
+    _pz->fill(p4.pz(), weight);
 
-    pt()->fill(bsm::pt(p4), weight);
-    eta()->fill(bsm::eta(p4), weight);
-    phi()->fill(bsm::phi(p4), weight);
-    mass()->fill(bsm::mass(p4), weight);
+    _pt->fill(bsm::pt(p4), weight);
+    _eta->fill(bsm::eta(p4), weight);
+    _phi->fill(bsm::phi(p4), weight);
+    _mass->fill(bsm::mass(p4), weight);
 
-    mt()->fill(bsm::mt(p4), weight);
-    et()->fill(bsm::et(p4), weight);
+    _mt->fill(bsm::mt(p4), weight);
+    _et->fill(bsm::et(p4), weight);
 }
 
 const H1Ptr P4Monitor::energy() const
@@ -485,16 +599,16 @@ P4Monitor::ObjectPtr P4Monitor::clone() const
 
 void P4Monitor::print(std::ostream &out) const
 {
-    out << setw(16) << left << " [e]" << *energy() << endl;
-    out << setw(16) << left << " [px]" << *px() << endl;
-    out << setw(16) << left << " [py]" << *py() << endl;
-    out << setw(16) << left << " [pz]" << *pz() << endl;
-    out << setw(16) << left << " [pt]" << *pt() << endl;
-    out << setw(16) << left << " [eta]" << *eta() << endl;
-    out << setw(16) << left << " [phi]" << *phi() << endl;
-    out << setw(16) << left << " [mass]" << *mass() << endl;
-    out << setw(16) << left << " [mt]" << *mt() << endl;
-    out << setw(16) << left << " [et]" << *et();
+    out << setw(16) << left << " [e]" << *_energy << endl;
+    out << setw(16) << left << " [px]" << *_px << endl;
+    out << setw(16) << left << " [py]" << *_py << endl;
+    out << setw(16) << left << " [pz]" << *_pz << endl;
+    out << setw(16) << left << " [pt]" << *_pt << endl;
+    out << setw(16) << left << " [eta]" << *_eta << endl;
+    out << setw(16) << left << " [phi]" << *_phi << endl;
+    out << setw(16) << left << " [mass]" << *_mass << endl;
+    out << setw(16) << left << " [mt]" << *_mt << endl;
+    out << setw(16) << left << " [et]" << *_et;
 }
 
 
@@ -520,10 +634,28 @@ GenParticleMonitor::GenParticleMonitor(const GenParticleMonitor &object):
     monitor(_status);
 }
 
+void GenParticleMonitor::enableSummaries()
+{
+    P4Monitor::enableSummaries();
+
+    _pdg_id->enableSummary();
+    _status->enableSummary();
+}
+
+NamedSummaries GenParticleMonitor::summaries() const
+{
+    NamedSummaries summaries = P4Monitor::summaries();
+
+    addSummary(summaries, "pdg_id", _pdg_id);
+    addSummary(summaries, "status", _status);
+
+    return summaries;
+}
+
 void GenParticleMonitor::fill(const GenParticle &particle, const float &weight)
 {
-    pdg_id()->fill(particle.id(), weight);
-    status()->fill(particle.status(), weight);
+    _pdg_id->fill(particle.id(), weight);
+    _status->fill(particle.status(), weight);
 
     P4Monitor::fill(particle.physics_object().p4(), weight);
 }
@@ -550,8 +682,8 @@ GenParticleMonitor::ObjectPtr GenParticleMonitor::clone() const
 
 void GenParticleMonitor::print(std::ostream &out) const
 {
-    out << setw(10) << left << " [PDG id]" << *pdg_id() << endl;
-    out << setw(10) << left << " [status]" << *status() << endl;
+    out << setw(10) << left << " [PDG id]" << *_pdg_id << endl;
+    out << setw(10) << left << " [status]" << *_status << endl;
 
     P4Monitor::print(out);
 }
@@ -586,9 +718,29 @@ MissingEnergyMonitor::MissingEnergyMonitor(const MissingEnergyMonitor &object)
     monitor(_z);
 }
 
+void MissingEnergyMonitor::enableSummaries()
+{
+    _pt->enableSummary();
+    _x->enableSummary();
+    _y->enableSummary();
+    _z->enableSummary();
+}
+
+NamedSummaries MissingEnergyMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "pt", _pt);
+    addSummary(summaries, "x", _x);
+    addSummary(summaries, "y", _y);
+    addSummary(summaries, "z", _z);
+
+    return summaries;
+}
+
 void MissingEnergyMonitor::fill(const MissingEnergy &missing_energy, const float &weight)
 {
-    pt()->fill(bsm::pt(missing_energy.p4()), weight);
+    _pt->fill(bsm::pt(missing_energy.p4()), weight);
 }
 
 const H1Ptr MissingEnergyMonitor::pt() const
@@ -623,10 +775,10 @@ MissingEnergyMonitor::ObjectPtr MissingEnergyMonitor::clone() const
 
 void MissingEnergyMonitor::print(std::ostream &out) const
 {
-    out << setw(16) << left << " [pt]" << *pt() << endl;
-    out << setw(16) << left << " [x]" << *x() << endl;
-    out << setw(16) << left << " [y]" << *y() << endl;
-    out << setw(16) << left << " [z]" << *z();
+    out << setw(16) << left << " [pt]" << *_pt << endl;
+    out << setw(16) << left << " [x]" << *_x << endl;
+    out << setw(16) << left << " [y]" << *_y << endl;
+    out << setw(16) << left << " [z]" << *_z;
 }
 
 
@@ -655,9 +807,27 @@ MuonsMonitor::MuonsMonitor(const MuonsMonitor &object)
     monitor(_leading_pt);
 }
 
+void MuonsMonitor::enableSummaries()
+{
+    _multiplicity->enableSummary();
+    _pt->enableSummary();
+    _leading_pt->enableSummary();
+}
+
+NamedSummaries MuonsMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "multiplicity", _multiplicity);
+    addSummary(summaries, "pt", _pt);
+    addSummary(summaries, "leading_pt", _leading_pt);
+
+    return summaries;
+}
+
 void MuonsMonitor::fill(const Muons &muons, const float &weight)
 {
-    multiplicity()->fill(muons.size(), weight);
+    _multiplicity->fill(muons.size(), weight);
 
     float max_muon_pt = 0;
     float muon_pt = 0;
@@ -667,7 +837,7 @@ void MuonsMonitor::fill(const Muons &muons, const float &weight)
     {
         muon_pt = bsm::pt(muon->physics_object().p4());
 
-        pt()->fill(muon_pt, weight);
+        _pt->fill(muon_pt, weight);
 
         if (muon_pt <= max_muon_pt)
             continue;
@@ -676,7 +846,7 @@ void MuonsMonitor::fill(const Muons &muons, const float &weight)
     }
 
     if (max_muon_pt)
-        leading_pt()->fill(max_muon_pt, weight);
+        _leading_pt->fill(max_muon_pt, weight);
 }
 
 const H1Ptr MuonsMonitor::multiplicity() const
@@ -707,9 +877,9 @@ MuonsMonitor::ObjectPtr MuonsMonitor::clone() const
 void MuonsMonitor::print(std::ostream &out) const
 {
     out << setw(16) << left << " [multiplicity]"
-        << *multiplicity() << endl;
-    out << setw(16) << left << " [pt]" << *pt() << endl;
-    out << setw(16) << left << " [leading pt] " << *leading_pt();
+        << *_multiplicity << endl;
+    out << setw(16) << left << " [pt]" << *_pt << endl;
+    out << setw(16) << left << " [leading pt] " << *_leading_pt;
 }
 
 
@@ -742,18 +912,38 @@ PrimaryVerticesMonitor::PrimaryVerticesMonitor(const PrimaryVerticesMonitor &obj
     monitor(_z);
 }
 
+void PrimaryVerticesMonitor::enableSummaries()
+{
+    _multiplicity->enableSummary();
+    _x->enableSummary();
+    _y->enableSummary();
+    _z->enableSummary();
+}
+
+NamedSummaries PrimaryVerticesMonitor::summaries() const
+{
+    NamedSummaries summaries;
+
+    addSummary(summaries, "multiplicity", _multiplicity);
+    addSummary(summaries, "x", _x);
+    addSummary(summaries, "y", _y);
+    addSummary(summaries, "z", _z);
+
+    return summaries;
+}
+
 void PrimaryVerticesMonitor::fill(const PrimaryVertices &primary_vertices,
         const float &weight)
 {
-    multiplicity()->fill(primary_vertices.size(), weight);
+    _multiplicity->fill(primary_vertices.size(), weight);
 
     for(PrimaryVertices::const_iterator primary_vertex = primary_vertices.begin();
             primary_vertices.end() != primary_vertex;
             ++primary_vertex)
     {
-        x()->fill(primary_vertex->vertex().x(), weight);
-        y()->fill(primary_vertex->vertex().y(), weight);
-        z()->fill(primary_vertex->vertex().z(), weight);
+        _x->fill(primary_vertex->vertex().x(), weight);
+        _y->fill(primary_vertex->vertex().y(), weight);
+        _z->fill(primary_vertex->vertex().z(), weight);
     }
 }
 
@@ -790,8 +980,8 @@ PrimaryVerticesMonitor::ObjectPtr PrimaryVerticesMonitor::clone() const
 void PrimaryVerticesMonitor::print(std::ostream &out) const
 {
     out << setw(16) << left << " [multiplicity]"
-        << *multiplicity() << endl;
-    out << setw(16) << left << " [x]" << *x() << endl;
-    out << setw(16) << left << " [y]" << *y() << endl;
-    out << setw(16) << left << " [z]" << *z();
+        << *_multiplicity << endl;
+    out << setw(16) << left << " [x]" << *_x << endl;
+    out << setw(16) << left << " [y]" << *_y << endl;
+    out << setw(16) << left << " [z]" << *_z;
 }
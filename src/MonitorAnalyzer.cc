@@ -21,7 +21,57 @@ using namespace std;
 using boost::dynamic_pointer_cast;
 
 using bsm::MonitorAnalyzer;
+using bsm::MonitorDelegate;
+using bsm::MonitorOptions;
 
+// Monitor Options
+//
+MonitorOptions::MonitorOptions()
+{
+    _delegate = 0;
+
+    _description.reset(new po::options_description("Monitor Options"));
+    _description->add_options()
+        ("summaries",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&MonitorOptions::setSummaries, this)),
+         "Save mean, rms and quantiles of the monitored values next to "
+         "histograms")
+    ;
+}
+
+void MonitorOptions::setDelegate(MonitorDelegate *delegate)
+{
+    if (_delegate != delegate)
+        _delegate = delegate;
+}
+
+MonitorDelegate *MonitorOptions::delegate() const
+{
+    return _delegate;
+}
+
+// Options interface
+//
+MonitorOptions::DescriptionPtr MonitorOptions::description() const
+{
+    return _description;
+}
+
+// Private
+//
+void MonitorOptions::setSummaries()
+{
+    if (!delegate())
+        return;
+
+    delegate()->setSummaries();
+}
+
+
+
+// Monitor Analyzer
+//
 MonitorAnalyzer::MonitorAnalyzer()
 {
     _pf_electrons.reset(new ElectronsMonitor());
@@ -92,6 +142,19 @@ const MonitorAnalyzer::PVMonitorPtr MonitorAnalyzer::primaryVertices() const
     return _primary_vertices;
 }
 
+// Monitor Delegate interface
+//
+void MonitorAnalyzer::setSummaries()
+{
+    // Means, rms and quantiles do not depend on the histograms binning
+    //
+    _pf_electrons->enableSummaries();
+    _pf_muons->enableSummaries();
+    _jets->enableSummaries();
+    _missing_energy->enableSummaries();
+    _primary_vertices->enableSummaries();
+}
+
 void MonitorAnalyzer::onFileOpen(const std::string &filename, const Input *)
 {
 }
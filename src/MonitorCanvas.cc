@@ -18,6 +18,7 @@
 
 #include "interface/Monitor.h"
 #include "interface/MonitorCanvas.h"
+#include "interface/StreamSummary.h"
 
 using namespace std;
 
@@ -67,6 +68,18 @@ bool Canvas::popd()
     return result;
 }
 
+void Canvas::writeSummaries(const NamedSummaries &summaries)
+{
+    for(NamedSummaries::const_iterator summary = summaries.begin();
+            summaries.end() != summary;
+            ++summary)
+    {
+        TH1Ptr histogram = convert(*summary->second);
+        histogram->SetName((summary->first + "_summary").c_str());
+        histogram->Write();
+    }
+}
+
 string Canvas::folder()
 {
     if (_folder.empty())
@@ -162,6 +175,8 @@ void DeltaCanvas::write(const DeltaMonitor &monitor, TDirectory *parent)
     _ptrel_vs_r->SetName("ptrel_vs_dr");
     _ptrel_vs_r->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -208,6 +223,8 @@ void ElectronCanvas::write(const ElectronsMonitor &monitor, TDirectory *parent)
     _pt->SetName("pt");
     _pt->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -273,6 +290,8 @@ void JetCanvas::write(const JetsMonitor &monitor, TDirectory *parent)
     _children->SetName("children");
     _children->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -382,6 +401,8 @@ void P4Canvas::write(const P4Monitor &monitor, TDirectory *parent)
     _et->SetName("et");
     _et->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -464,6 +485,8 @@ void MissingEnergyCanvas::write(const MissingEnergyMonitor &monitor, TDirectory
     _z->SetName("z");
     _z->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -510,6 +533,8 @@ void MuonCanvas::write(const MuonsMonitor &monitor, TDirectory *parent)
     _pt->SetName("pt");
     _pt->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
 
@@ -566,5 +591,7 @@ void PrimaryVertexCanvas::write(const PrimaryVerticesMonitor &monitor, TDirector
     _z->SetName("z");
     _z->Write();
 
+    writeSummaries(monitor.summaries());
+
     popd();
 }
@@ -122,6 +122,8 @@ MttbarAnalyzer::MttbarAnalyzer():
 
     _gen_events.reset(new Counter());
     monitor(_gen_events);
+
+    registerOutputs();
 }
 
 MttbarAnalyzer::MttbarAnalyzer(const MttbarAnalyzer &object):
@@ -174,6 +176,8 @@ MttbarAnalyzer::MttbarAnalyzer(const MttbarAnalyzer &object):
     _gen_events =
         dynamic_pointer_cast<Counter>(object._gen_events->clone());
     monitor(_gen_events);
+
+    registerOutputs();
 }
 
 bsm::JetEnergyCorrectionDelegate *MttbarAnalyzer::getJetEnergyCorrectionDelegate() const
@@ -236,6 +240,11 @@ const MttbarAnalyzer::DeltaMonitorPtr MttbarAnalyzer::topDeltaMonitor() const
     return _top_delta_monitor;
 }
 
+const bsm::OutputRegistry *MttbarAnalyzer::outputs() const
+{
+    return &_outputs;
+}
+
 void MttbarAnalyzer::setUseGeneratorMass(const bool &flag)
 {
     _use_generator_mass = flag;
@@ -305,7 +314,7 @@ void MttbarAnalyzer::process(const Event *event)
         //
         struct Solution
         {
-            Solution(): deltaRmin(FLT_MAX), deltaRlh(0)
+            Solution(): deltaRmin(FLT_MAX), deltaRlh(0), index(0)
             {
             }
 
@@ -315,14 +324,17 @@ void MttbarAnalyzer::process(const Event *event)
 
             float deltaRmin;
             float deltaRlh;
+
+            uint64_t index; // Generator hypothesis index
         } best_solution;
 
         // Loop over all possible hypotheses and pick the best one
         // Note: take into account all reconstructed neutrino solutions
         //
+        Generator::Hypothesis hypothesis;
         do
         {
-            Generator::Hypothesis hypothesis = generator.hypothesis();
+            generator.hypothesis(hypothesis);
 
             // Skip hypotheses that do not have any leptonic or hadronic jets
             //
@@ -348,55 +360,54 @@ void MttbarAnalyzer::process(const Event *event)
                     hypothesis.leptonic.end() != jet;
                     ++jet)
             {
-                const float jet_pt = pt(*(*jet)->corrected_p4);
+                const float jet_pt = (*jet)->corrected_pt;
                 if (jet_pt > highest_pt)
                     hardest_jet = &*(*jet);
             }
 
-            ltop += *hardest_jet->corrected_p4;
+            ltop += hardest_jet->corrected_p4;
 
             // the neutrino will be taken into account later
             //
 
             // htop is a sum of all jet p4s assigned to the hadronic leg
             //
-            LorentzVector htop;
-            for(Generator::Iterators::const_iterator jet =
-                        hypothesis.hadronic.begin();
-                    hypothesis.hadronic.end() != jet;
-                    ++jet)
-            {
-                htop += *(*jet)->corrected_p4;
-            }
+            const LorentzVector &htop = generator.p4(Generator::HADRONIC);
 
-            // Take into account all neutrino solutions. Solutions are kept in
-            // a vector of pointer
+            // Take into account all neutrino solutions
             //
             for(NeutrinoReconstruct::Solutions::const_iterator neutrino =
                         neutrinos.begin();
                     neutrinos.end() != neutrino;
                     ++neutrino)
             {
-                const LorentzVector &neutrino_p4 = *(*neutrino);
+                const LorentzVector &neutrino_p4 = *neutrino;
 
                 LorentzVector ltop_tmp = ltop;
                 ltop_tmp += neutrino_p4;
 
-                const float deltaRmin = dr(ltop_tmp, *hardest_jet->corrected_p4)
+                const float deltaRmin = dr(ltop_tmp, hardest_jet->corrected_p4)
                     + dr(ltop_tmp, lepton_p4)
                     + dr(ltop_tmp, neutrino_p4);
 
                 const float deltaRlh = dr(ltop_tmp, htop);
 
+                // Equal solutions are resolved in favour of the smaller
+                // hypothesis index
+                //
                 if (deltaRmin < best_solution.deltaRmin
                         || (deltaRmin == best_solution.deltaRmin
-                            && deltaRlh > best_solution.deltaRlh))
+                            && (deltaRlh > best_solution.deltaRlh
+                                || (deltaRlh == best_solution.deltaRlh
+                                    && FLT_MAX != best_solution.deltaRmin
+                                    && generator.index() < best_solution.index))))
                 {
                     best_solution.deltaRmin = deltaRmin;
                     best_solution.deltaRlh = deltaRlh;
                     best_solution.ltop = ltop_tmp;
                     best_solution.htop = htop;
                     best_solution.missing_energy = neutrino_p4;
+                    best_solution.index = generator.index();
                 }
             }
         }
@@ -491,6 +502,14 @@ void MttbarAnalyzer::print(std::ostream &out) const
 
 // Private
 //
+void MttbarAnalyzer::registerOutputs()
+{
+    _outputs.add("mreco", _mreco, "m_{t#bar{t}}^{reco} [GeV/c^{2}]");
+    _outputs.add("mltop_vs_mhtop", _mltop_vs_mhtop,
+            "m_{t,lepton} [GeV/c^{2}]",
+            "m_{t,hadron} [GeV/c^{2}]");
+}
+
 float MttbarAnalyzer::getMttbarGen(const Event *event)
 {
     float mass_gen = 0;
@@ -0,0 +1,380 @@
+// Output Registry
+//
+// Analyzers register histograms, cutflows and monitors with names, axis
+// titles and output directories at booking. AppController writes all
+// registered products into the output file in one pass at the end of the
+// job
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+
+#include <boost/shared_ptr.hpp>
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TH2.h>
+
+#include "bsm_stat/interface/H1.h"
+#include "bsm_stat/interface/H2.h"
+#include "bsm_stat/interface/Utility.h"
+#include "interface/Bootstrap.h"
+#include "interface/Cut.h"
+#include "interface/Monitor.h"
+#include "interface/MonitorCanvas.h"
+#include "interface/OutputRegistry.h"
+#include "interface/Selector.h"
+#include "interface/StatProxy.h"
+#include "interface/StreamSummary.h"
+
+using namespace std;
+
+using bsm::BootstrapH1;
+using bsm::MultiplicityCutflow;
+using bsm::OutputRegistry;
+
+void OutputRegistry::add(const string &name,
+        const H1ProxyPtr &histogram,
+        const string &x_title,
+        const string &directory)
+{
+    Product product;
+    product.name = name;
+    product.directory = directory;
+    product.x_title = x_title;
+    product.h1 = histogram;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &name,
+        const H2ProxyPtr &histogram,
+        const string &x_title,
+        const string &y_title,
+        const string &directory)
+{
+    Product product;
+    product.name = name;
+    product.directory = directory;
+    product.x_title = x_title;
+    product.y_title = y_title;
+    product.h2 = histogram;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &name,
+        const BootstrapH1Ptr &histogram,
+        const string &x_title,
+        const string &directory)
+{
+    Product product;
+    product.name = name;
+    product.directory = directory;
+    product.x_title = x_title;
+    product.bootstrap = histogram;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &name,
+        const CutflowPtr &cutflow,
+        const CutflowContent &content,
+        const string &x_title,
+        const string &directory)
+{
+    Product product;
+    product.name = name;
+    product.directory = directory;
+    product.x_title = x_title;
+    product.cutflow = cutflow;
+    product.cutflow_content = content;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &title,
+        const P4MonitorPtr &monitor,
+        const string &axis_subtitle,
+        const string &directory)
+{
+    Product product;
+    product.name = title;
+    product.directory = directory;
+    product.x_title = axis_subtitle;
+    product.p4 = monitor;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &title,
+        const GenParticleMonitorPtr &monitor,
+        const string &axis_subtitle,
+        const string &directory)
+{
+    Product product;
+    product.name = title;
+    product.directory = directory;
+    product.x_title = axis_subtitle;
+    product.gen_particle = monitor;
+
+    _products.push_back(product);
+}
+
+void OutputRegistry::add(const string &title,
+        const DeltaMonitorPtr &monitor,
+        const string &axis_subtitle,
+        const string &directory)
+{
+    Product product;
+    product.name = title;
+    product.directory = directory;
+    product.x_title = axis_subtitle;
+    product.delta = monitor;
+
+    _products.push_back(product);
+}
+
+bool OutputRegistry::empty() const
+{
+    return _products.empty();
+}
+
+uint32_t OutputRegistry::size() const
+{
+    return _products.size();
+}
+
+void OutputRegistry::enableSummaries()
+{
+    for(Products::iterator product = _products.begin();
+            _products.end() != product;
+            ++product)
+    {
+        if (product->h1)
+            product->h1->enableSummary();
+        else if (product->p4)
+            product->p4->enableSummaries();
+        else if (product->gen_particle)
+            product->gen_particle->enableSummaries();
+        else if (product->delta)
+            product->delta->enableSummaries();
+    }
+}
+
+void OutputRegistry::write(TDirectory *output) const
+{
+    if (!output
+            || _products.empty())
+        return;
+
+    TDirectory *pwd = gDirectory;
+
+    // Group products by directory: every directory is created and entered
+    // once. Products keep the registration order within directory
+    //
+    typedef multimap<string, const Product *> Directories;
+
+    Directories directories;
+    for(Products::const_iterator product = _products.begin();
+            _products.end() != product;
+            ++product)
+    {
+        directories.insert(make_pair(product->directory, &*product));
+    }
+
+    for(Directories::const_iterator product = directories.begin();
+            directories.end() != product;
+            )
+    {
+        const string &name = product->first;
+
+        TDirectory *directory = output;
+        if (!name.empty())
+        {
+            directory = output->GetDirectory(name.c_str());
+            if (!directory)
+                directory = output->mkdir(name.c_str());
+        }
+
+        if (!directory
+                || !directory->cd())
+        {
+            cerr << "failed to change output folder to: " << name << endl;
+
+            product = directories.upper_bound(name);
+
+            continue;
+        }
+
+        for(Directories::const_iterator end = directories.upper_bound(name);
+                end != product;
+                ++product)
+        {
+            const Product &output_product = *product->second;
+
+            if (output_product.h1)
+            {
+                stat::TH1Ptr h1 = convert(*output_product.h1->histogram());
+                h1->SetName(output_product.name.c_str());
+
+                if (!output_product.x_title.empty())
+                    h1->GetXaxis()->SetTitle(output_product.x_title.c_str());
+
+                h1->Write();
+
+                if (output_product.h1->summary())
+                {
+                    stat::TH1Ptr summary =
+                        convert(*output_product.h1->summary());
+
+                    summary->SetName((output_product.name
+                                      + "_summary").c_str());
+                    summary->Write();
+                }
+            }
+            else if (output_product.h2)
+            {
+                stat::TH2Ptr h2 = convert(*output_product.h2->histogram());
+                h2->SetName(output_product.name.c_str());
+
+                if (!output_product.x_title.empty())
+                    h2->GetXaxis()->SetTitle(output_product.x_title.c_str());
+
+                if (!output_product.y_title.empty())
+                    h2->GetYaxis()->SetTitle(output_product.y_title.c_str());
+
+                h2->Write();
+            }
+            else if (output_product.bootstrap)
+                write(output_product.name,
+                      output_product.x_title,
+                      *output_product.bootstrap);
+            else if (output_product.cutflow)
+                write(output_product.name,
+                      output_product.x_title,
+                      *output_product.cutflow,
+                      output_product.cutflow_content);
+            else if (output_product.p4)
+            {
+                P4Canvas canvas(output_product.name, output_product.x_title);
+                canvas.write(*output_product.p4, directory);
+            }
+            else if (output_product.gen_particle)
+            {
+                GenParticleCanvas canvas(output_product.name,
+                                         output_product.x_title);
+                canvas.write(*output_product.gen_particle, directory);
+            }
+            else if (output_product.delta)
+            {
+                DeltaCanvas canvas(output_product.name,
+                                   output_product.x_title);
+                canvas.write(*output_product.delta, directory);
+            }
+        }
+    }
+
+    if (pwd)
+        pwd->cd();
+}
+
+// Private
+//
+OutputRegistry::Product::Product():
+    cutflow_content(CUTFLOW_EVENTS)
+{
+}
+
+void OutputRegistry::write(const string &name,
+        const string &x_title,
+        const BootstrapH1 &bootstrap) const
+{
+    TH2D histogram(name.c_str(), name.c_str(),
+                   bootstrap.bins(), bootstrap.min(), bootstrap.max(),
+                   bootstrap.replicas(), 0, bootstrap.replicas());
+
+    if (!x_title.empty())
+        histogram.GetXaxis()->SetTitle(x_title.c_str());
+
+    histogram.GetYaxis()->SetTitle("replica");
+
+    // Under- and overflows along X are kept
+    //
+    for(uint32_t replica = 0; bootstrap.replicas() > replica; ++replica)
+        for(uint32_t bin = 0; bootstrap.bins() + 1 >= bin; ++bin)
+            histogram.SetBinContent(bin, replica + 1,
+                                    bootstrap.content(replica, bin));
+
+    histogram.Write();
+}
+
+void OutputRegistry::write(const string &name,
+        const string &x_title,
+        const MultiplicityCutflow &cutflow,
+        const CutflowContent &content) const
+{
+    stat::H1 histogram(cutflow.size(), 0, cutflow.size());
+    for(uint32_t cut = 0; cutflow.size() > cut; ++cut)
+    {
+        const CounterPtr events = cutflow.cut(cut)->events();
+        if (!events->counts())
+            continue;
+
+        histogram.fill(cut, CUTFLOW_WEIGHTS == content
+                                ? events->sumOfWeights()
+                                : events->counts());
+    }
+
+    stat::TH1Ptr h1 = convert(histogram);
+    h1->SetName(name.c_str());
+
+    if (!x_title.empty())
+        h1->GetXaxis()->SetTitle(x_title.c_str());
+
+    h1->Write();
+}
+
+bool OutputRegistry::save(const string &file_name) const
+{
+    const string temporary_file_name(file_name + ".tmp");
+
+    TDirectory *pwd = gDirectory;
+    {
+        boost::shared_ptr<TFile> output(new TFile(temporary_file_name.c_str(),
+                                                  "RECREATE"));
+        if (!output->IsOpen())
+        {
+            cerr << "failed to open output file: " << temporary_file_name
+                << endl;
+
+            if (pwd)
+                pwd->cd();
+
+            return false;
+        }
+
+        write(output.get());
+
+        output->Close();
+    }
+
+    if (pwd)
+        pwd->cd();
+
+    if (rename(temporary_file_name.c_str(), file_name.c_str()))
+    {
+        cerr << "failed to replace output file: " << file_name << endl;
+
+        remove(temporary_file_name.c_str());
+
+        return false;
+    }
+
+    return true;
+}
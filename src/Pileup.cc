@@ -87,12 +87,14 @@ void PileupOptions::setPileup(const string &filename,
 
 // Pileup
 //
-Pileup::Pileup()
+Pileup::Pileup():
+    _plane(LookupTable::NOMINAL)
 {
 }
 
 Pileup::Pileup(const Pileup &obj):
-    _weight(obj._weight)
+    _weights(obj._weights),
+    _plane(obj._plane)
 {
 }
 
@@ -107,19 +109,23 @@ void Pileup::setPileup(const string &filename, const Systematic &systematic)
     }
 
     string histogram;
+    LookupTable::Plane plane;
 
     switch(systematic)
     {
         case UP:
             histogram = "WHistUp";
+            plane = LookupTable::UP;
             break;
 
         case DOWN:
             histogram = "WHistDown";
+            plane = LookupTable::DOWN;
             break;
 
         case NONE:
             histogram = "WHist";
+            plane = LookupTable::NOMINAL;
             break;
 
         default:
@@ -128,54 +134,50 @@ void Pileup::setPileup(const string &filename, const Systematic &systematic)
     }
 
     TH3D *weights = dynamic_cast<TH3D *>(in->Get(histogram.c_str()));
+    if (!weights)
+    {
+        cerr << "pileup weights " << histogram << " are not found in: "
+            << filename << endl;
 
-    // Translate weights into local array
-    //
-    _weight.clear();
+        return;
+    }
 
-    for(uint32_t prev_bunch = 0,
-            max_prev_bunch = weights->GetXaxis()->GetNbins();
-            max_prev_bunch > prev_bunch;
-            ++prev_bunch)
+    // Number of interactions above 34 use the last bin
+    //
+    if (_weights.empty())
     {
-        Weight2D weight2d;
-        for(uint32_t curr_bunch = 0,
-                max_curr_bunch = weights->GetYaxis()->GetNbins();
-                max_curr_bunch > curr_bunch;
-                ++curr_bunch)
-        {
-            Weight1D weight1d;
-            for(uint32_t next_bunch = 0,
-                    max_next_bunch = weights->GetZaxis()->GetNbins();
-                    max_next_bunch > next_bunch;
-                    ++next_bunch)
-            {
-                weight1d.push_back(static_cast<float>(
-                        weights->GetBinContent(prev_bunch,
-                            curr_bunch,
-                            next_bunch)));
-            }
-
-            weight2d.push_back(weight1d);
-        }
-
-        _weight.push_back(weight2d);
+        const int prev_bins = min(weights->GetXaxis()->GetNbins(), 35);
+        const int curr_bins = min(weights->GetYaxis()->GetNbins(), 35);
+        const int next_bins = min(weights->GetZaxis()->GetNbins(), 35);
+
+        _weights = LookupTable(LookupAxis(prev_bins, 0, prev_bins),
+                LookupAxis(curr_bins, 0, curr_bins),
+                LookupAxis(next_bins, 0, next_bins));
     }
 
+    // Weights were always read starting from the underflow bin: keep the
+    // same mapping of the number of interactions
+    //
+    if (!_weights.load(plane, weights, 0))
+        return;
+
+    _plane = plane;
+
     clog << "pileup loaded " << filename << endl;
 }
 
 const float Pileup::scale(const Event *event) const
 {
-    return !_weight.empty()
+    return _weights.has(_plane)
         && event->has_pileup()
         && event->pileup().has_interactions_prev_bunch()
         && event->pileup().has_interactions_curr_bunch()
         && event->pileup().has_interactions_next_bunch()
 
-        ? _weight[min(static_cast<int>(event->pileup().interactions_prev_bunch()), 34)]
-                 [min(static_cast<int>(event->pileup().interactions_curr_bunch()), 34)]
-                 [min(static_cast<int>(event->pileup().interactions_next_bunch()), 34)]
+        ? _weights.value(event->pileup().interactions_prev_bunch(),
+                event->pileup().interactions_curr_bunch(),
+                event->pileup().interactions_next_bunch(),
+                _plane)
 
         : 0;
 }
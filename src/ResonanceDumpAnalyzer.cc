@@ -20,7 +20,6 @@
 #include "interface/Algorithm.h"
 #include "interface/CorrectedJet.h"
 #include "interface/Pileup.h"
-#include "interface/GenResonance.h"
 #include "interface/StatProxy.h"
 #include "interface/ResonanceDumpAnalyzer.h"
 #include "interface/Utility.h"
@@ -182,46 +181,46 @@ void ResonanceDumpAnalyzer::process(const Event *event)
                     ++jet)
             {
                 _log << setw(width) << right << " "
-                    << (*_format)(*jet->corrected_p4) << endl;
+                    << (*_format)(jet->corrected_p4) << endl;
             }
 
             _log << "-- Gen Particles ----" << endl;
 
-            typedef vector<TopQuark> TopQuarks;
-            typedef ::google::protobuf::RepeatedPtrField<GenParticle>
-                GenParticles;
+            _gen_decay.fill(event);
 
-            TopQuarks top_quarks = gen_resonance(event);
-            for(TopQuarks::const_iterator top_quark = top_quarks.begin();
-                    top_quarks.end() != top_quark;
-                    ++top_quark)
+            const GenDecay::Indices &particles = _gen_decay.hardParticles();
+            for(GenDecay::Indices::const_iterator top = particles.begin();
+                    particles.end() != top;
+                    ++top)
             {
+                if (6 != abs(_gen_decay.id(*top)))
+                    continue;
+
                 _log << setw(width) << right << "top: "
-                    << (*_format)(top_quark->gen_particle()->physics_object().p4()) << endl;
+                    << (*_format)(_gen_decay.particle(*top).physics_object().p4()) << endl;
 
-                for(GenParticles::const_iterator child =
-                            top_quark->gen_particle()->child().begin();
-                        top_quark->gen_particle()->child().end()
-                            != child;
+                for(uint32_t child = _gen_decay.firstChild(*top),
+                            end = child + _gen_decay.children(*top);
+                        end > child;
                         ++child)
                 {
-                    if (24 == abs(child->id()))
+                    if (24 == abs(_gen_decay.id(child)))
                         continue;
 
-                    _log << setw(width - 2) << right << child->id()
-                        << ": " << (*_format)(child->physics_object().p4()) << endl;
+                    _log << setw(width - 2) << right << _gen_decay.id(child)
+                        << ": " << (*_format)(_gen_decay.particle(child).physics_object().p4()) << endl;
                 }
 
-                if (top_quark->wboson())
+                const uint32_t wboson = _gen_decay.findChild(*top, 24);
+                if (GenDecay::NONE != wboson)
                 {
-                    for(GenParticles::const_iterator child =
-                                top_quark->wboson()->gen_particle()->child().begin();
-                            top_quark->wboson()->gen_particle()->child().end()
-                                != child;
+                    for(uint32_t child = _gen_decay.firstChild(wboson),
+                                end = child + _gen_decay.children(wboson);
+                            end > child;
                             ++child)
                     {
-                        _log << setw(width - 2) << right << child->id()
-                            << ": " << (*_format)(child->physics_object().p4())
+                        _log << setw(width - 2) << right << _gen_decay.id(child)
+                            << ": " << (*_format)(_gen_decay.particle(child).physics_object().p4())
                             << endl;
                     }
                 }
@@ -236,7 +235,7 @@ void ResonanceDumpAnalyzer::process(const Event *event)
             _log << setw(width) << right << "met: "
                 << (*_format)(resonance.neutrino) << endl;
 
-            for(ResonanceReconstructor::LorentzVectors::const_iterator p4 =
+            for(NeutrinoReconstruct::Solutions::const_iterator p4 =
                         resonance.neutrinos.begin();
                     resonance.neutrinos.end() != p4;
                     ++p4)
@@ -261,7 +260,7 @@ void ResonanceDumpAnalyzer::process(const Event *event)
                 else
                     _log << "ltop jets: ";
 
-                _log << (*_format)(*jet->corrected_p4) << endl;
+                _log << (*_format)(jet->corrected_p4) << endl;
             }
 
             for(ResonanceReconstructor::CorrectedJets::const_iterator jet =
@@ -275,7 +274,7 @@ void ResonanceDumpAnalyzer::process(const Event *event)
                 else
                     _log << "htop jets: ";
 
-                _log << (*_format)(*jet->corrected_p4) << endl;
+                _log << (*_format)(jet->corrected_p4) << endl;
             }
             _log << endl;
 
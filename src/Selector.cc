@@ -23,6 +23,7 @@
 #include "bsm_input/interface/Muon.pb.h"
 #include "bsm_input/interface/Physics.pb.h"
 #include "bsm_input/interface/PrimaryVertex.pb.h"
+#include "interface/CorrectedJet.h"
 #include "interface/Cut.h"
 #include "interface/Selector.h"
 #include "interface/Utility.h"
@@ -33,6 +34,10 @@ using boost::dynamic_pointer_cast;
 
 using bsm::Selector;
 
+using bsm::P4Arrays;
+using bsm::ElectronArrays;
+using bsm::MuonArrays;
+
 using bsm::CutPtr;
 using bsm::ElectronSelector;
 using bsm::JetEnergyCorrectionDelegate;
@@ -44,6 +49,85 @@ using bsm::PrimaryVertexSelector;
 using bsm::WJetSelector;
 using bsm::LockSelectorEventCounterOnUpdate;
 
+// P4 Arrays
+//
+void P4Arrays::clear()
+{
+    pt.clear();
+    abs_eta.clear();
+}
+
+void P4Arrays::push_back(const LorentzVector &p4)
+{
+    pt.push_back(bsm::pt(p4));
+    abs_eta.push_back(fabs(bsm::eta(p4)));
+}
+
+void P4Arrays::push_back(const CorrectedJet &jet)
+{
+    pt.push_back(jet.corrected_pt);
+    abs_eta.push_back(fabs(jet.corrected_eta));
+}
+
+
+
+// Electron Arrays
+//
+void ElectronArrays::clear()
+{
+    P4Arrays::clear();
+
+    abs_dz.clear();
+}
+
+void ElectronArrays::push_back(const Electron &electron,
+        const PrimaryVertex &pv)
+{
+    P4Arrays::push_back(electron.physics_object().p4());
+
+    abs_dz.push_back(fabs(electron.physics_object().vertex().z()
+                - pv.vertex().z()));
+}
+
+
+
+// Muon Arrays
+//
+void MuonArrays::clear()
+{
+    P4Arrays::clear();
+
+    has_extra.clear();
+    is_global.clear();
+    is_tracker.clear();
+    segments.clear();
+    muon_hits.clear();
+    normalized_chi2.clear();
+    tracker_hits.clear();
+    pixel_hits.clear();
+    abs_d0.clear();
+    abs_dz.clear();
+}
+
+void MuonArrays::push_back(const Muon &muon, const PrimaryVertex &pv)
+{
+    P4Arrays::push_back(muon.physics_object().p4());
+
+    has_extra.push_back(muon.has_extra());
+    is_global.push_back(muon.extra().is_global());
+    is_tracker.push_back(muon.extra().is_tracker());
+    segments.push_back(muon.extra().number_of_matches());
+    muon_hits.push_back(muon.global_track().hits());
+    normalized_chi2.push_back(muon.global_track().normalized_chi2());
+    tracker_hits.push_back(muon.inner_track().hits());
+    pixel_hits.push_back(muon.extra().pixel_hits());
+    abs_d0.push_back(fabs(muon.extra().d0()));
+    abs_dz.push_back(fabs(muon.physics_object().vertex().z()
+                - pv.vertex().z()));
+}
+
+
+
 // Selector
 //
 Selector::Selector(const Selector &object)
@@ -146,6 +230,17 @@ bool ElectronSelector::apply(const Electron &electron, const PrimaryVertex &pv)
                     - pv.vertex().z()));
 }
 
+uint32_t ElectronSelector::apply(const ElectronArrays &electrons,
+        SelectionMask &mask)
+{
+    // Each cut is applied to electrons that passed all previous cuts
+    //
+    return cut(PT)->apply(electrons.pt, mask)
+        && cut(ETA)->apply(electrons.abs_eta, mask)
+        ? cut(PRIMARY_VERTEX)->apply(electrons.abs_dz, mask)
+        : 0;
+}
+
 CutPtr ElectronSelector::cut(const Cut &cut_id) const
 {
     return getCut(cut_id);
@@ -182,6 +277,13 @@ bool JetSelector::apply(const Jet &jet)
         && cut(ETA)->apply(fabs(bsm::eta(jet.physics_object().p4())));
 }
 
+uint32_t JetSelector::apply(const P4Arrays &jets, SelectionMask &mask)
+{
+    return cut(PT)->apply(jets.pt, mask)
+        ? cut(ETA)->apply(jets.abs_eta, mask)
+        : 0;
+}
+
 uint32_t JetSelector::id() const
 {
     return core::ID<JetSelector>::get();
@@ -241,6 +343,11 @@ bsm::CutPtr MultiplicityCutflow::cut(const uint32_t &cut_id) const
     return getCut(cut_id);
 }
 
+uint32_t MultiplicityCutflow::size() const
+{
+    return cuts();
+}
+
 bool MultiplicityCutflow::apply(const uint32_t &number)
 {
     // It does not make sense to apply all cuts. Only Nth one:
@@ -253,6 +360,12 @@ bool MultiplicityCutflow::apply(const uint32_t &number)
     return true;
 }
 
+void MultiplicityCutflow::setWeight(const double &weight)
+{
+    for(uint32_t cut_id = 0; cuts() > cut_id; ++cut_id)
+        cut(cut_id)->setWeight(weight);
+}
+
 uint32_t MultiplicityCutflow::id() const
 {
     return core::ID<MultiplicityCutflow>::get();
@@ -310,6 +423,32 @@ bool MuonSelector::apply(const Muon &muon, const PrimaryVertex &pv)
                     - pv.vertex().z()));
 }
 
+uint32_t MuonSelector::apply(const MuonArrays &muons, SelectionMask &mask)
+{
+    // Muons without extra information are not selected
+    //
+    uint32_t selected = 0;
+    for(uint32_t i = 0, size = mask.size(); size > i; ++i)
+    {
+        mask[i] &= muons.has_extra[i];
+        selected += mask[i];
+    }
+
+    return selected
+        && cut(PT)->apply(muons.pt, mask)
+        && cut(ETA)->apply(muons.abs_eta, mask)
+        && cut(IS_GLOBAL)->apply(muons.is_global, mask)
+        && cut(IS_TRACKER)->apply(muons.is_tracker, mask)
+        && cut(MUON_SEGMENTS)->apply(muons.segments, mask)
+        && cut(MUON_HITS)->apply(muons.muon_hits, mask)
+        && cut(MUON_NORMALIZED_CHI2)->apply(muons.normalized_chi2, mask)
+        && cut(TRACKER_HITS)->apply(muons.tracker_hits, mask)
+        && cut(PIXEL_HITS)->apply(muons.pixel_hits, mask)
+        && cut(D0)->apply(muons.abs_d0, mask)
+        ? cut(PRIMARY_VERTEX)->apply(muons.abs_dz, mask)
+        : 0;
+}
+
 uint32_t MuonSelector::id() const
 {
     return core::ID<MuonSelector>::get();
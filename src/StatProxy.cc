@@ -13,21 +13,64 @@
 using bsm::H1Proxy;
 using bsm::H2Proxy;
 
-H1Proxy::H1Proxy(const uint32_t &bins, const float &min, const float &max)
+H1Proxy::H1Proxy(const uint32_t &bins,
+        const float &min,
+        const float &max,
+        const Allocation &allocation):
+    _bins(bins),
+    _min(min),
+    _max(max),
+    _allocation(allocation)
 {
-    _histogram.reset(new stat::H1(bins, min, max));
+    if (ALLOCATE_ON_BOOKING == _allocation)
+        allocate();
 }
 
-H1Proxy::H1Proxy(const H1Proxy &proxy)
+H1Proxy::H1Proxy(const H1Proxy &proxy):
+    _bins(proxy._bins),
+    _min(proxy._min),
+    _max(proxy._max),
+    _allocation(proxy._allocation)
 {
-    _histogram.reset(new stat::H1(*proxy._histogram));
+    if (proxy._histogram)
+        _histogram.reset(new stat::H1(*proxy._histogram));
+    else if (ALLOCATE_ON_BOOKING == _allocation)
+        allocate();
+
+    if (proxy._summary)
+        _summary.reset(new StreamSummary(*proxy._summary));
 }
 
 const H1Proxy::H1Ptr H1Proxy::histogram() const
 {
+    allocate();
+
     return _histogram;
 }
 
+void H1Proxy::enableSummary()
+{
+    if (_summary)
+        return;
+
+    _summary.reset(new StreamSummary());
+}
+
+const bsm::StreamSummaryPtr H1Proxy::summary() const
+{
+    return _summary;
+}
+
+void H1Proxy::fill(const double &x, const double &weight)
+{
+    allocate();
+
+    _histogram->fill(x, weight);
+
+    if (_summary)
+        _summary->fill(x, weight);
+}
+
 uint32_t H1Proxy::id() const
 {
     return core::ID<H1Proxy>::get();
@@ -49,12 +92,32 @@ void H1Proxy::merge(const ObjectPtr &pointer)
     if (!object)
         return;
 
-    *_histogram += *object->_histogram;
+    // There is nothing to add if other histogram was never filled
+    //
+    if (!object->_histogram)
+        return;
+
+    *histogram() += *object->_histogram;
+
+    if (_summary
+            && object->_summary)
+        _summary->merge(object->_summary);
 }
 
 void H1Proxy::print(std::ostream &out) const
 {
-    out << *_histogram;
+    out << *histogram();
+
+    if (_summary)
+        out << " " << *_summary;
+}
+
+// Private
+//
+void H1Proxy::allocate() const
+{
+    if (!_histogram)
+        _histogram.reset(new stat::H1(_bins, _min, _max));
 }
 
 
@@ -67,21 +130,52 @@ H2Proxy::H2Proxy(const uint32_t &x_bins,
 
         const uint32_t &y_bins,
         const float &y_min,
-        const float &y_max)
+        const float &y_max,
+
+        const Allocation &allocation):
+    _x_bins(x_bins),
+    _x_min(x_min),
+    _x_max(x_max),
+    _y_bins(y_bins),
+    _y_min(y_min),
+    _y_max(y_max),
+    _allocation(allocation)
 {
-    _histogram.reset(new stat::H2(x_bins, x_min, x_max, y_bins, y_min, y_max));
+    if (ALLOCATE_ON_BOOKING == _allocation)
+        allocate();
 }
 
-H2Proxy::H2Proxy(const H2Proxy &proxy)
+H2Proxy::H2Proxy(const H2Proxy &proxy):
+    _x_bins(proxy._x_bins),
+    _x_min(proxy._x_min),
+    _x_max(proxy._x_max),
+    _y_bins(proxy._y_bins),
+    _y_min(proxy._y_min),
+    _y_max(proxy._y_max),
+    _allocation(proxy._allocation)
 {
-    _histogram.reset(new stat::H2(*proxy._histogram));
+    if (proxy._histogram)
+        _histogram.reset(new stat::H2(*proxy._histogram));
+    else if (ALLOCATE_ON_BOOKING == _allocation)
+        allocate();
 }
 
 const H2Proxy::H2Ptr H2Proxy::histogram() const
 {
+    allocate();
+
     return _histogram;
 }
 
+void H2Proxy::fill(const double &x,
+        const double &y,
+        const double &weight)
+{
+    allocate();
+
+    _histogram->fill(x, y, weight);
+}
+
 uint32_t H2Proxy::id() const
 {
     return core::ID<H2Proxy>::get();
@@ -103,10 +197,22 @@ void H2Proxy::merge(const ObjectPtr &pointer)
     if (!object)
         return;
 
-    *_histogram += *object->_histogram;
+    if (!object->_histogram)
+        return;
+
+    *histogram() += *object->_histogram;
 }
 
 void H2Proxy::print(std::ostream &out) const
 {
-    out << *_histogram;
+    out << *histogram();
+}
+
+// Private
+//
+void H2Proxy::allocate() const
+{
+    if (!_histogram)
+        _histogram.reset(new stat::H2(_x_bins, _x_min, _x_max,
+                                      _y_bins, _y_min, _y_max));
 }
@@ -0,0 +1,450 @@
+// Streaming summaries of filled values
+//
+// Moments and quantiles of values are kept independently of the histogram
+// binning. Both use fixed memory and are mergeable: per-thread clones are
+// combined with the same merge() as histograms. Values are accepted with any
+// weight sign: summaries describe the same sample as the histograms
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+#include <boost/pointer_cast.hpp>
+
+#include <TH1.h>
+
+#include "bsm_core/interface/ID.h"
+#include "bsm_stat/interface/Utility.h"
+#include "interface/StreamSummary.h"
+
+using namespace std;
+
+using bsm::Moments;
+using bsm::QuantileSketch;
+using bsm::StreamSummary;
+
+// Moments
+//
+Moments::Moments():
+    _entries(0),
+    _shift(0),
+    _weight(0),
+    _sum(0),
+    _sum2(0),
+    _min(numeric_limits<double>::max()),
+    _max(-numeric_limits<double>::max())
+{
+}
+
+void Moments::fill(const double &x, const double &weight)
+{
+    if (!_entries)
+        _shift = x;
+
+    ++_entries;
+
+    const double delta = x - _shift;
+    _weight += weight;
+    _sum += weight * delta;
+    _sum2 += weight * delta * delta;
+
+    _min = std::min(_min, x);
+    _max = std::max(_max, x);
+}
+
+void Moments::merge(const Moments &moments)
+{
+    if (!moments._entries)
+        return;
+
+    if (!_entries)
+    {
+        *this = moments;
+
+        return;
+    }
+
+    // Move sums of the other moments to the shift in use
+    //
+    const double shift = moments._shift - _shift;
+
+    _sum2 += moments._sum2
+        + 2 * shift * moments._sum
+        + shift * shift * moments._weight;
+    _sum += moments._sum + shift * moments._weight;
+    _weight += moments._weight;
+
+    _entries += moments._entries;
+
+    _min = std::min(_min, moments._min);
+    _max = std::max(_max, moments._max);
+}
+
+uint64_t Moments::entries() const
+{
+    return _entries;
+}
+
+double Moments::weight() const
+{
+    return _weight;
+}
+
+double Moments::mean() const
+{
+    return _weight ? _shift + _sum / _weight : 0;
+}
+
+double Moments::variance() const
+{
+    if (!_weight)
+        return 0;
+
+    const double mean = _sum / _weight;
+
+    return std::max(0.0, _sum2 / _weight - mean * mean);
+}
+
+double Moments::rms() const
+{
+    return sqrt(variance());
+}
+
+double Moments::min() const
+{
+    return _entries ? _min : 0;
+}
+
+double Moments::max() const
+{
+    return _entries ? _max : 0;
+}
+
+
+
+// Quantile Sketch
+//
+QuantileSketch::QuantileSketch(const uint32_t &compression):
+    _compression(std::max<uint32_t>(compression, 10)),
+    _weight(0),
+    _min(numeric_limits<double>::max()),
+    _max(-numeric_limits<double>::max())
+{
+}
+
+void QuantileSketch::fill(const double &x, const double &weight)
+{
+    if (0 >= weight)
+        return;
+
+    Centroid centroid;
+    centroid.mean = x;
+    centroid.weight = weight;
+
+    _buffer.push_back(centroid);
+
+    _weight += weight;
+    _min = std::min(_min, x);
+    _max = std::max(_max, x);
+
+    if (5 * _compression <= _buffer.size())
+        compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch &sketch)
+{
+    if (!sketch._weight)
+        return;
+
+    sketch.compress();
+
+    _buffer.insert(_buffer.end(),
+                   sketch._centroids.begin(),
+                   sketch._centroids.end());
+
+    _weight += sketch._weight;
+    _min = std::min(_min, sketch._min);
+    _max = std::max(_max, sketch._max);
+
+    compress();
+}
+
+double QuantileSketch::weight() const
+{
+    return _weight;
+}
+
+double QuantileSketch::quantile(const double &q) const
+{
+    compress();
+
+    if (_centroids.empty())
+        return 0;
+
+    if (1 == _centroids.size())
+        return _centroids.front().mean;
+
+    // Centroid mass is spread around its mean: interpolate between the
+    // centroid centers and use min/max at the edges
+    //
+    const double target = std::max(0.0, std::min(1.0, q)) * _weight;
+
+    double center = _centroids.front().weight / 2;
+    if (target <= center)
+        return _min + (_centroids.front().mean - _min) * target / center;
+
+    for(Centroids::const_iterator centroid = _centroids.begin(), next = centroid + 1;
+            _centroids.end() != next;
+            ++centroid, ++next)
+    {
+        const double next_center = center
+            + (centroid->weight + next->weight) / 2;
+
+        if (target < next_center)
+            return centroid->mean
+                + (next->mean - centroid->mean)
+                    * (target - center) / (next_center - center);
+
+        center = next_center;
+    }
+
+    const double tail = _weight - center;
+
+    return tail
+        ? _centroids.back().mean
+            + (_max - _centroids.back().mean) * (target - center) / tail
+        : _max;
+}
+
+double QuantileSketch::rank(const double &x) const
+{
+    compress();
+
+    if (_centroids.empty()
+            || x <= _min)
+        return 0;
+
+    if (x >= _max)
+        return _weight;
+
+    // Same interpolation as in quantile(): linear between the centroid
+    // centers, min and max
+    //
+    double center = _centroids.front().weight / 2;
+    if (x < _centroids.front().mean)
+        return center * (x - _min) / (_centroids.front().mean - _min);
+
+    for(Centroids::const_iterator centroid = _centroids.begin(), next = centroid + 1;
+            _centroids.end() != next;
+            ++centroid, ++next)
+    {
+        const double next_center = center
+            + (centroid->weight + next->weight) / 2;
+
+        if (x < next->mean)
+            return center
+                + (next_center - center)
+                    * (x - centroid->mean) / (next->mean - centroid->mean);
+
+        center = next_center;
+    }
+
+    return center
+        + (_weight - center)
+            * (x - _centroids.back().mean) / (_max - _centroids.back().mean);
+}
+
+uint32_t QuantileSketch::centroids() const
+{
+    compress();
+
+    return _centroids.size();
+}
+
+// Private
+//
+bool QuantileSketch::isLess(const Centroid &left, const Centroid &right)
+{
+    return left.mean < right.mean;
+}
+
+void QuantileSketch::compress() const
+{
+    if (_buffer.empty())
+        return;
+
+    _buffer.insert(_buffer.end(), _centroids.begin(), _centroids.end());
+    sort(_buffer.begin(), _buffer.end(), isLess);
+
+    _centroids.clear();
+
+    // Neighbour centroids are combined while the weight stays below the
+    // limit 4 * W * q * (1 - q) / compression: small at the tails, large
+    // around the median
+    //
+    Centroid current = _buffer.front();
+    double weight_so_far = 0;
+    for(Centroids::const_iterator centroid = _buffer.begin() + 1;
+            _buffer.end() != centroid;
+            ++centroid)
+    {
+        const double weight = current.weight + centroid->weight;
+        const double q = (weight_so_far + weight / 2) / _weight;
+
+        if (weight <= 4 * _weight * q * (1 - q) / _compression)
+        {
+            current.mean += (centroid->mean - current.mean)
+                * centroid->weight / weight;
+            current.weight = weight;
+
+            continue;
+        }
+
+        _centroids.push_back(current);
+        weight_so_far += current.weight;
+
+        current = *centroid;
+    }
+
+    _centroids.push_back(current);
+
+    _buffer.clear();
+}
+
+
+
+// Stream Summary
+//
+StreamSummary::StreamSummary(const uint32_t &compression):
+    _quantiles(compression),
+    _negative_quantiles(compression)
+{
+}
+
+void StreamSummary::fill(const double &x, const double &weight)
+{
+    _moments.fill(x, weight);
+
+    if (0 < weight)
+        _quantiles.fill(x, weight);
+    else if (0 > weight)
+        _negative_quantiles.fill(x, -weight);
+}
+
+const Moments &StreamSummary::moments() const
+{
+    return _moments;
+}
+
+double StreamSummary::quantile(const double &q) const
+{
+    if (!_negative_quantiles.weight())
+        return _quantiles.quantile(q);
+
+    const double weight = _quantiles.weight() - _negative_quantiles.weight();
+    if (0 >= weight)
+        return 0;
+
+    // Net rank is not monotonic for negative weights: bisect for the value
+    // where the net rank crosses target
+    //
+    const double target = std::max(0.0, std::min(1.0, q)) * weight;
+
+    double low = _moments.min();
+    double high = _moments.max();
+    for(uint32_t iteration = 0; 64 > iteration && low < high; ++iteration)
+    {
+        const double middle = (low + high) / 2;
+
+        if (_quantiles.rank(middle) - _negative_quantiles.rank(middle)
+                < target)
+            low = middle;
+        else
+            high = middle;
+    }
+
+    return (low + high) / 2;
+}
+
+uint32_t StreamSummary::id() const
+{
+    return core::ID<StreamSummary>::get();
+}
+
+StreamSummary::ObjectPtr StreamSummary::clone() const
+{
+    return ObjectPtr(new StreamSummary(*this));
+}
+
+void StreamSummary::merge(const ObjectPtr &pointer)
+{
+    if (id() != pointer->id())
+        return;
+
+    boost::shared_ptr<StreamSummary> object =
+        boost::dynamic_pointer_cast<StreamSummary>(pointer);
+
+    if (!object)
+        return;
+
+    _moments.merge(object->_moments);
+    _quantiles.merge(object->_quantiles);
+    _negative_quantiles.merge(object->_negative_quantiles);
+}
+
+void StreamSummary::print(std::ostream &out) const
+{
+    out << "entries: " << _moments.entries()
+        << " mean: " << _moments.mean()
+        << " rms: " << _moments.rms()
+        << " min: " << _moments.min()
+        << " max: " << _moments.max()
+        << " q05: " << quantile(.05)
+        << " q50: " << quantile(.5)
+        << " q95: " << quantile(.95);
+}
+
+// Helpers
+//
+bsm::stat::TH1Ptr bsm::convert(const StreamSummary &summary)
+{
+    const Moments &moments = summary.moments();
+
+    const char *labels[] = {
+        "entries", "weight", "mean", "rms", "min", "max",
+        "q01", "q05", "q25", "q50", "q75", "q95", "q99"
+    };
+
+    const double values[] = {
+        static_cast<double>(moments.entries()),
+        moments.weight(),
+        moments.mean(),
+        moments.rms(),
+        moments.min(),
+        moments.max(),
+        summary.quantile(.01),
+        summary.quantile(.05),
+        summary.quantile(.25),
+        summary.quantile(.5),
+        summary.quantile(.75),
+        summary.quantile(.95),
+        summary.quantile(.99)
+    };
+
+    const int bins = sizeof(values) / sizeof(values[0]);
+
+    stat::TH1Ptr histogram(new TH1D("summary", "summary", bins, 0, bins));
+    histogram->SetDirectory(0);
+    for(int bin = 0; bins > bin; ++bin)
+    {
+        histogram->GetXaxis()->SetBinLabel(bin + 1, labels[bin]);
+        histogram->SetBinContent(bin + 1, values[bin]);
+    }
+
+    return histogram;
+}
@@ -318,7 +318,7 @@ void SynchAnalyzer::dump(const Event *event)
             _synch_selector->niceJets().end() != jet;
             ++jet)
     {
-        _out << "corr p4: " << *jet->corrected_p4 << endl;
+        _out << "corr p4: " << jet->corrected_p4 << endl;
         _out << format(*jet->jet) << endl;
         _out << "correction: " << jet->correction << endl;
 
@@ -356,7 +356,7 @@ void SynchAnalyzer::dump(const Event *event)
     else
     {
         _out << "closest jet" << endl;
-        _out << "corr p4: " << *closest_jet->corrected_p4 << endl;
+        _out << "corr p4: " << closest_jet->corrected_p4 << endl;
         _out << format(*closest_jet->jet) << endl;
 
         const LorentzVector *lepton_p4 =
@@ -364,8 +364,8 @@ void SynchAnalyzer::dump(const Event *event)
             ? &(*_synch_selector->goodElectrons().begin())->physics_object().p4()
             : &(*_synch_selector->goodMuons().begin())->physics_object().p4();
 
-        _out << "ptrel: " << ptrel(*lepton_p4, *closest_jet->corrected_p4)
-            << " dr: " << dr(*lepton_p4, *closest_jet->corrected_p4);
+        _out << "ptrel: " << ptrel(*lepton_p4, closest_jet->corrected_p4)
+            << " dr: " << dr(*lepton_p4, closest_jet->corrected_p4);
     }
 }
 
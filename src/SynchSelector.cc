@@ -251,7 +251,15 @@ void SynchSelectorOptions::setWflavor(std::string mode)
 SynchSelector::SynchSelector():
     _lepton_mode(ELECTRON),
     _cut_mode(CUT_2D),
-    _qcd_template(false)
+    _categories(false),
+    _event_lepton_mode(ELECTRON),
+    _event_wflavor(WJETS),
+    _is_categorized(false),
+    _event_cuts(0),
+    _good_met(0),
+    _qcd_template(false),
+    _electron_triggers_pass(false),
+    _muon_triggers_pass(false)
 {
     // Cutflow table
     //
@@ -352,8 +360,19 @@ SynchSelector::SynchSelector():
 SynchSelector::SynchSelector(const SynchSelector &object):
     _lepton_mode(object._lepton_mode),
     _cut_mode(object._cut_mode),
+    _categories(object._categories),
+    _event_lepton_mode(object._lepton_mode),
+    _event_wflavor(WJETS),
+    _is_categorized(false),
+    _event_cuts(0),
+    _good_met(0),
     _qcd_template(object._qcd_template),
-    _triggers(object._triggers.begin(), object._triggers.end())
+    _triggers(object._triggers.begin(), object._triggers.end()),
+    _electron_triggers(object._electron_triggers.begin(),
+                       object._electron_triggers.end()),
+    _muon_triggers(object._muon_triggers.begin(), object._muon_triggers.end()),
+    _electron_triggers_pass(false),
+    _muon_triggers_pass(false)
 {
     // Cutflow Table
     //
@@ -361,6 +380,16 @@ SynchSelector::SynchSelector(const SynchSelector &object):
         dynamic_pointer_cast<MultiplicityCutflow>(object._cutflow->clone());
     monitor(_cutflow);
 
+    for(CategoryCutflows::const_iterator cutflow =
+                object._category_cutflows.begin();
+            object._category_cutflows.end() != cutflow;
+            ++cutflow)
+    {
+        _category_cutflows.push_back(
+                dynamic_pointer_cast<MultiplicityCutflow>((*cutflow)->clone()));
+        monitor(_category_cutflows.back());
+    }
+
     // Selectors
     //
     _primary_vertex_selector = 
@@ -525,15 +554,21 @@ bool SynchSelector::apply(const Event *event)
 {
     invalidate_cache();
 
-    _cutflow->apply(PRESELECTION);
+    _event_lepton_mode = _lepton_mode;
+    _event_wflavor = WJETS;
+    _is_categorized = false;
+    _event_cuts = 0;
+
+    applyCutflow(PRESELECTION);
 
     _good_primary_vertices.clear();
     _good_electrons.clear();
     _good_muons.clear();
     _nice_jets.clear();
     _good_jets.clear();
-    _good_met.reset();
+    _good_met = 0;
     _closest_jet = _nice_jets.end();
+    _kinematics.clear();
 
     // QCD template
     if (qcdTemplate())
@@ -578,6 +613,42 @@ SynchSelector::CutflowPtr SynchSelector::cutflow() const
     return _cutflow;
 }
 
+bool SynchSelector::categories() const
+{
+    return _categories;
+}
+
+uint32_t SynchSelector::category() const
+{
+    return _event_lepton_mode * (WLIGHT + 1) + _event_wflavor;
+}
+
+SynchSelector::CutflowPtr SynchSelector::cutflow(const uint32_t &category) const
+{
+    return _category_cutflows.at(category);
+}
+
+string SynchSelector::categoryName(const uint32_t &category)
+{
+    string name = MUON == category / (WLIGHT + 1)
+        ? "muon"
+        : "electron";
+
+    switch(category % (WLIGHT + 1))
+    {
+        case WBX:       name += "_wbx";
+                        break;
+
+        case WCX:       name += "_wcx";
+                        break;
+
+        case WLIGHT:    name += "_wlight";
+                        break;
+    }
+
+    return name;
+}
+
 const SynchSelector::GoodPrimaryVertices
     &SynchSelector::goodPrimaryVertices() const
 {
@@ -614,9 +685,14 @@ SynchSelector::GoodJets::const_iterator SynchSelector::closestJet() const
     return _closest_jet;
 }
 
+const bsm::EventKinematics &SynchSelector::kinematics() const
+{
+    return _kinematics;
+}
+
 SynchSelector::LeptonMode SynchSelector::leptonMode() const
 {
-    return _lepton_mode;
+    return _event_lepton_mode;
 }
 
 SynchSelector::CutMode SynchSelector::cutMode() const
@@ -649,6 +725,7 @@ bsm::JetEnergyResolutionDelegate *SynchSelector::getJERDelegate() const
 void SynchSelector::setLeptonMode(const LeptonMode &lepton_mode)
 {
     _lepton_mode = lepton_mode;
+    _event_lepton_mode = lepton_mode;
 }
 
 void SynchSelector::setCutMode(const CutMode &cut_mode)
@@ -713,6 +790,22 @@ void SynchSelector::setWflavor(const Wflavor &flavor)
     wflavor()->enable();
 }
 
+void SynchSelector::setCategories(const bool &value)
+{
+    _categories = value;
+
+    if (!_categories
+            || !_category_cutflows.empty())
+        return;
+
+    for(uint32_t category = 0; CATEGORIES > category; ++category)
+    {
+        _category_cutflows.push_back(
+                CutflowPtr(new MultiplicityCutflow(SELECTIONS - 1)));
+        monitor(_category_cutflows.back());
+    }
+}
+
 // Jet Energy Correction Delegate interface
 //
 void SynchSelector::setCorrection(const Level &level,
@@ -731,10 +824,10 @@ void SynchSelector::setChildCorrection()
 {
     // there is not guarantee that --child-corrrection argument is used before
     // any level of the jet energy corrections file is specified. Therefore,
-    // files should be reloaded with ne object.
+    // loaded corrections are shared with new object.
     //
     shared_ptr<JetEnergyCorrections> jec(new ChildJetEnergyCorrections());
-    jec->setCorrectionFiles(_jec->correctionFiles());
+    jec->shareCorrections(*_jec);
 
     // Activate new Jet Energy Corrections
     //
@@ -743,6 +836,11 @@ void SynchSelector::setChildCorrection()
     monitor(_jec);
 }
 
+void SynchSelector::setCorrectionGrid(const bool &validate)
+{
+    _jec->setCorrectionGrid(validate);
+}
+
 // Trigger Delegate interface
 //
 void SynchSelector::setTrigger(const Trigger &trigger)
@@ -750,6 +848,16 @@ void SynchSelector::setTrigger(const Trigger &trigger)
     _triggers.push_back(trigger.hash());
 }
 
+void SynchSelector::setElectronTrigger(const Trigger &trigger)
+{
+    _electron_triggers.push_back(trigger.hash());
+}
+
+void SynchSelector::setMuonTrigger(const Trigger &trigger)
+{
+    _muon_triggers.push_back(trigger.hash());
+}
+
 // Selector interface
 //
 void SynchSelector::enable()
@@ -833,9 +941,35 @@ void SynchSelector::print(std::ostream &out) const
     _cutflow->cut(LTOP)->setName("pt(ltop)");
     _cutflow->cut(CHI2)->setName("Chi2");
 
-    out << "Cutflow [" << _lepton_mode << ": " << _cut_mode << "]" << endl;
+    out << *_jec;
+
+    if (!categories())
+    {
+        out << "Cutflow [" << _lepton_mode << ": " << _cut_mode << "]" << endl;
+        out << *_cutflow << endl;
+        out << endl;
+
+        return;
+    }
+
+    out << "Cutflow [all categories: " << _cut_mode << "]" << endl;
     out << *_cutflow << endl;
     out << endl;
+
+    for(uint32_t category = 0; CATEGORIES > category; ++category)
+    {
+        const CutflowPtr &cutflow = _category_cutflows[category];
+        if (!cutflow->cut(PRESELECTION)->events()->counts())
+            continue;
+
+        for(uint32_t cut = 0; SELECTIONS > cut; ++cut)
+            cutflow->cut(cut)->setName(_cutflow->cut(cut)->name());
+
+        out << "Cutflow [" << categoryName(category) << ": " << _cut_mode
+            << "]" << endl;
+        out << *cutflow << endl;
+        out << endl;
+    }
 }
 
 bool SynchSelector::reconstruction(const bool &value)
@@ -844,7 +978,7 @@ bool SynchSelector::reconstruction(const bool &value)
         return true;
 
     return reconstruction()->apply(value)
-        && (_cutflow->apply(RECONSTRUCTION), true);
+        && (applyCutflow(RECONSTRUCTION), true);
 }
 
 bool SynchSelector::ltop(const float &value)
@@ -853,7 +987,7 @@ bool SynchSelector::ltop(const float &value)
         return true;
 
     return ltop()->apply(value)
-        && (_cutflow->apply(LTOP), true);
+        && (applyCutflow(LTOP), true);
 }
 
 bool SynchSelector::chi2(const float &value)
@@ -862,7 +996,7 @@ bool SynchSelector::chi2(const float &value)
         return true;
 
     return chi2()->apply(value)
-        && (_cutflow->apply(CHI2), true);
+        && (applyCutflow(CHI2), true);
 }
 
 // Private
@@ -874,7 +1008,7 @@ bool SynchSelector::splitWflavor(const Event *event)
 
     if (WJETS == wflavor()->value())
         return wflavor()->apply(static_cast<uint32_t>(WJETS)) &&
-               (_cutflow->apply(WFLAVOR), true);
+               (applyCutflow(WFLAVOR), true);
 
     // It is assumed that Wjets sample has W->l+nu (leptonic decay) and
     // all jets are additional generated objects
@@ -897,7 +1031,7 @@ bool SynchSelector::splitWflavor(const Event *event)
         {
             case 5: // Wbx
                 return wflavor()->apply(static_cast<uint32_t>(WBX)) &&
-                       (_cutflow->apply(WFLAVOR), true);
+                       (applyCutflow(WFLAVOR), true);
 
             case 4:
                 wcx = true;
@@ -906,17 +1040,20 @@ bool SynchSelector::splitWflavor(const Event *event)
     }
 
     return wflavor()->apply(static_cast<uint32_t>(wcx ? WCX : WLIGHT)) &&
-           (_cutflow->apply(WFLAVOR), true);
+           (applyCutflow(WFLAVOR), true);
 }
 
 bool SynchSelector::splitWflavor()
 {
     if (wflavor()->isDisabled())
-        return true;
+        return (categorize(), true);
 
-    if (WJETS == wflavor()->value())
+    if (WJETS == wflavor()->value()
+            && !categories())
+    {
         return wflavor()->apply(static_cast<uint32_t>(WJETS)) &&
-               (_cutflow->apply(WFLAVOR), true);
+               (applyCutflow(WFLAVOR), true);
+    }
 
     // It is assumed that Wjets sample has W->l+nu (leptonic decay) and
     // all jets are additional generated objects
@@ -925,11 +1062,10 @@ bool SynchSelector::splitWflavor()
     //  Wcx     if there is no b-quark and at least one c-quark is found
     //  Wlight  otherwise
     //
-    typedef ::google::protobuf::RepeatedPtrField<Jet> Jets;
-
-    bool wcx = false;
+    Wflavor flavor = WLIGHT;
     for(GoodJets::const_iterator jet = goodJets().begin();
-            goodJets().end() != jet;
+            goodJets().end() != jet
+                && WBX != flavor;
             ++jet)
     {
         if (!jet->jet->has_gen_parton())
@@ -937,52 +1073,90 @@ bool SynchSelector::splitWflavor()
 
         switch(abs(jet->jet->gen_parton().id()))
         {
-            case 5: // Wbx
-                return wflavor()->apply(static_cast<uint32_t>(WBX)) &&
-                       (_cutflow->apply(WFLAVOR), true);
+            case 5: flavor = WBX;
+                    break;
 
-            case 4:
-                wcx = true;
-                break;
+            case 4: flavor = WCX;
+                    break;
         }
     }
 
-    return wflavor()->apply(static_cast<uint32_t>(wcx ? WCX : WLIGHT)) &&
-           (_cutflow->apply(WFLAVOR), true);
+    // Each flavor is a separate category: selected flavor is not applied
+    //
+    if (categories())
+    {
+        _event_wflavor = flavor;
+
+        applyCutflow(WFLAVOR);
+        categorize();
+
+        return true;
+    }
+
+    return wflavor()->apply(static_cast<uint32_t>(flavor)) &&
+           (applyCutflow(WFLAVOR), true);
 }
 
 bool SynchSelector::triggers(const Event *event)
 {
-    bool result = _triggers.empty();
-
-    if (!result
-            && event->hlt().trigger().size())
+    bool result = false;
+    if (categories())
     {
-        // OR triggers
+        // Lepton channel is not known yet: keep decision of each channel
+        // triggers until the lepton is selected
         //
-        typedef ::google::protobuf::RepeatedPtrField<Trigger> PBTriggers;
-        for(Triggers::const_iterator trigger = _triggers.begin();
-                _triggers.end() != trigger
-                    && !result;
-                ++trigger)
+        _electron_triggers_pass = passTriggers(event, ELECTRON);
+        _muon_triggers_pass = passTriggers(event, MUON);
+
+        result = _electron_triggers_pass
+            || _muon_triggers_pass;
+    }
+    else
+        result = passTriggers(event, _lepton_mode);
+
+    return result
+        && (applyCutflow(TRIGGER), true);
+}
+
+bool SynchSelector::passTriggers(const Event *event,
+        const LeptonMode &lepton_mode) const
+{
+    const Triggers &channel_triggers = ELECTRON == lepton_mode
+        ? _electron_triggers
+        : _muon_triggers;
+
+    const Triggers &triggers = channel_triggers.empty()
+        ? _triggers
+        : channel_triggers;
+
+    if (triggers.empty())
+        return true;
+
+    if (!event->hlt().trigger().size())
+        return false;
+
+    // OR triggers
+    //
+    typedef ::google::protobuf::RepeatedPtrField<Trigger> PBTriggers;
+    for(Triggers::const_iterator trigger = triggers.begin();
+            triggers.end() != trigger;
+            ++trigger)
+    {
+        for(PBTriggers::const_iterator hlt = event->hlt().trigger().begin();
+                event->hlt().trigger().end() != hlt;
+                ++hlt)
         {
-            for(PBTriggers::const_iterator hlt = event->hlt().trigger().begin();
-                    event->hlt().trigger().end() != hlt;
-                    ++hlt)
+            if (hlt->hash() == *trigger)
             {
-                if (hlt->hash() == *trigger)
-                {
-                    if (hlt->pass())
-                        result = true;
+                if (hlt->pass())
+                    return true;
 
-                    break;
-                }
+                break;
             }
         }
     }
 
-    return result
-        && (_cutflow->apply(TRIGGER), true);
+    return false;
 }
 
 bool SynchSelector::primaryVertices(const Event *event)
@@ -990,7 +1164,7 @@ bool SynchSelector::primaryVertices(const Event *event)
     selectGoodPrimaryVertices(event);
 
     return !goodPrimaryVertices().empty()
-        && (_cutflow->apply(PRIMARY_VERTEX), true);
+        && (applyCutflow(PRIMARY_VERTEX), true);
 }
 
 bool SynchSelector::jets(const Event *event)
@@ -1002,49 +1176,66 @@ bool SynchSelector::jets(const Event *event)
     //
     typedef ::google::protobuf::RepeatedPtrField<Jet> Jets;
 
-    LockSelectorEventCounterOnUpdate lock_nice_jets(*_nice_jet_selector);
-    LockSelectorEventCounterOnUpdate lock_good_jets(*_good_jet_selector);
+    // Corrected jets buffer is reused between events
+    //
+    _corrected_jets.resize(event->jet().size());
+    _jet_arrays.clear();
+
+    GoodJets::iterator corrected_jet = _corrected_jets.begin();
     const LorentzVector *met = &(event->missing_energy().p4());
     for(Jets::const_iterator jet = event->jet().begin();
             event->jet().end() != jet;
             ++jet)
     {
-        CorrectedJet correction = _jec->correctJet(&*jet,
-                event,
-                _good_electrons,
-                _good_muons,
-                met);
-
         // Skip jet if energy corrections failed
         //
-        if (!correction.corrected_p4)
+        if (!_jec->correctJet(*corrected_jet,
+                    &*jet,
+                    event,
+                    _good_electrons,
+                    _good_muons,
+                    met))
             continue;
 
-        _jer->correct(correction);
+        _jer->correct(*corrected_jet);
 
-        met = correction.corrected_met.get();
-        _good_met = correction.corrected_met;
+        met = &corrected_jet->corrected_met;
 
-        // Original jet in the event can not be modified and Jet Selector can
-        // only be applied to jet: therefore copy jet, set corrected p4 and
-        // apply selector
-        //
-        Jet corrected_jet;
-        corrected_jet.CopyFrom(*jet);
-        corrected_jet.mutable_physics_object()->mutable_p4()->CopyFrom(
-                *correction.corrected_p4);
+        _jet_arrays.push_back(*corrected_jet);
 
-        if (!_nice_jet_selector->apply(corrected_jet))
-            continue;
+        ++corrected_jet;
+    }
 
-        // Store original jet and corrected p4
-        //
-        _nice_jets.push_back(correction);
+    _corrected_jets.erase(corrected_jet, _corrected_jets.end());
 
-        if (!_good_jet_selector->apply(corrected_jet))
-            continue;
+    if (!_corrected_jets.empty())
+    {
+        _corrected_met.CopyFrom(*met);
+        _good_met = &_corrected_met;
+    }
+
+    // Apply selectors to corrected p4 of all jets at once: good jets should
+    // pass both nice and good selectors
+    //
+    _nice_jet_mask.assign(_jet_arrays.size(), 1);
+    {
+        LockSelectorEventCounterOnUpdate lock(*_nice_jet_selector);
+        _nice_jet_selector->apply(_jet_arrays, _nice_jet_mask);
+    }
+
+    _good_jet_mask = _nice_jet_mask;
+    {
+        LockSelectorEventCounterOnUpdate lock(*_good_jet_selector);
+        _good_jet_selector->apply(_jet_arrays, _good_jet_mask);
+    }
+
+    for(uint32_t i = 0, size = _corrected_jets.size(); size > i; ++i)
+    {
+        if (_nice_jet_mask[i])
+            _nice_jets.push_back(_corrected_jets[i]);
 
-        _good_jets.push_back(correction);
+        if (_good_jet_mask[i])
+            _good_jets.push_back(_corrected_jets[i]);
     }
 
     // Sort jets by pT
@@ -1053,32 +1244,77 @@ bool SynchSelector::jets(const Event *event)
     sort(_good_jets.begin(), _good_jets.end(), CorrectedPtGreater());
 
     return 1 < _good_jets.size()
-        && (_cutflow->apply(JET), true);
+        && (applyCutflow(JET), true);
 }
 
 bool SynchSelector::lepton()
 {
-    return (ELECTRON == _lepton_mode
-        ? !_good_electrons.empty()
-        : !_good_muons.empty())
+    // Lepton channels are exclusive after the second lepton veto: pick the
+    // channel by the leptons present in event
+    //
+    if (categories())
+    {
+        _event_lepton_mode = _good_electrons.empty() ? MUON : ELECTRON;
+
+        // Each channel is selected with its own triggers
+        //
+        if (!(ELECTRON == _event_lepton_mode
+                    ? _electron_triggers_pass
+                    : _muon_triggers_pass))
+            return false;
+    }
 
-        && (_cutflow->apply(LEPTON), true);
+    if (ELECTRON == _event_lepton_mode
+            ? _good_electrons.empty()
+            : _good_muons.empty())
+
+        return false;
+
+    // Selected objects are known: cache their kinematics for the rest of
+    // cuts and analyzers
+    //
+    _kinematics_leptons.clear();
+    if (ELECTRON == _event_lepton_mode)
+    {
+        for(GoodElectrons::const_iterator electron = _good_electrons.begin();
+                _good_electrons.end() != electron;
+                ++electron)
+        {
+            _kinematics_leptons.push_back(
+                    &(*electron)->physics_object().p4());
+        }
+    }
+    else
+    {
+        for(GoodMuons::const_iterator muon = _good_muons.begin();
+                _good_muons.end() != muon;
+                ++muon)
+        {
+            _kinematics_leptons.push_back(&(*muon)->physics_object().p4());
+        }
+    }
+
+    _kinematics.fill(_kinematics_leptons, _nice_jets, _good_jets, goodMET());
+
+    applyCutflow(LEPTON);
+
+    return true;
 }
 
 bool SynchSelector::secondElectronVeto()
 {
-    return (ELECTRON == _lepton_mode
+    return (ELECTRON == _event_lepton_mode
             ? 1 == _good_electrons.size()
             : _good_electrons.empty())
-        && (_cutflow->apply(VETO_SECOND_ELECTRON), true);
+        && (applyCutflow(VETO_SECOND_ELECTRON), true);
 }
 
 bool SynchSelector::secondMuonVeto()
 {
-    return (ELECTRON == _lepton_mode
+    return (ELECTRON == _event_lepton_mode
             ? _good_muons.empty()
             : 1 == _good_muons.size())
-        && (_cutflow->apply(VETO_SECOND_MUON), true);
+        && (applyCutflow(VETO_SECOND_MUON), true);
 }
 
 bool SynchSelector::isolationAnd2DCut()
@@ -1089,7 +1325,7 @@ bool SynchSelector::isolationAnd2DCut()
     const LorentzVector *lepton_p4 = 0;
     const PFIsolation *lepton_isolation = 0;
 
-    if (ELECTRON == _lepton_mode)
+    if (ELECTRON == _event_lepton_mode)
     {
         const Electron *electron = *_good_electrons.begin();
 
@@ -1118,7 +1354,7 @@ bool SynchSelector::isolationAnd2DCut()
     }
 
     return _cut->apply(result)
-        && (_cutflow->apply(CUT_LEPTON), true);
+        && (applyCutflow(CUT_LEPTON), true);
 }
 
 bool SynchSelector::leadingJetCut()
@@ -1126,18 +1362,20 @@ bool SynchSelector::leadingJetCut()
     if (leadingJet()->isDisabled())
         return true;
 
+    const CutValues &jet_pt =
+        _kinematics.jets(EventKinematics::GOOD_JETS).pt;
+
     float max_pt = 0;
-    for(GoodJets::const_iterator jet = _good_jets.begin();
-            _good_jets.end() != jet;
-            ++jet)
+    for(CutValues::const_iterator pt = jet_pt.begin();
+            jet_pt.end() != pt;
+            ++pt)
     {
-        const float jet_pt = pt(*jet->corrected_p4);
-        if (jet_pt > max_pt)
-            max_pt = jet_pt;
+        if (*pt > max_pt)
+            max_pt = *pt;
     }
 
     return leadingJet()->apply(max_pt)
-        && (_cutflow->apply(LEADING_JET), true);
+        && (applyCutflow(LEADING_JET), true);
 }
 
 bool SynchSelector::maxBtags()
@@ -1146,7 +1384,7 @@ bool SynchSelector::maxBtags()
         return true;
 
     return maxBtag()->apply(countBtaggedJets().first)
-        && (_cutflow->apply(MAX_BTAG), true);
+        && (applyCutflow(MAX_BTAG), true);
 }
 
 bool SynchSelector::minBtags()
@@ -1155,7 +1393,7 @@ bool SynchSelector::minBtags()
         return true;
 
     return minBtag()->apply(countBtaggedJets().first)
-        && (_cutflow->apply(MIN_BTAG), true);
+        && (applyCutflow(MIN_BTAG), true);
 }
 
 bool SynchSelector::htlepCut(const Event *event)
@@ -1163,13 +1401,9 @@ bool SynchSelector::htlepCut(const Event *event)
     if (htlep()->isDisabled())
         return true;
 
-    const LorentzVector &lepton_p4 = (ELECTRON == _lepton_mode 
-        ? (*_good_electrons.begin())->physics_object().p4()
-        : (*_good_muons.begin())->physics_object().p4());
-
-    return goodMET()
-        && htlep()->apply(pt(*goodMET()) + pt(lepton_p4))
-        && (_cutflow->apply(HTLEP), true);
+    return _kinematics.hasMET()
+        && htlep()->apply(_kinematics.metPt() + _kinematics.leptons().pt[0])
+        && (applyCutflow(HTLEP), true);
 }
 
 bool SynchSelector::triangularCut(const Event *event)
@@ -1177,18 +1411,15 @@ bool SynchSelector::triangularCut(const Event *event)
     if (tricut()->isDisabled())
         return true;
 
-    if (!goodMET())
+    if (!_kinematics.hasMET())
         return false;
 
-    const LorentzVector &met = *goodMET();
-
-    const float met_pt = pt(met);
+    const float met_pt = _kinematics.metPt();
 
-    const float dphi_el_met =
-        fabs(dphi(goodElectrons()[0]->physics_object().p4(), met));
+    const float dphi_el_met = _kinematics.leptonMetDphi();
 
     const float dphi_ljet_met =
-        fabs(dphi(*goodJets()[0].corrected_p4, met));
+        _kinematics.jetMetDphi(EventKinematics::GOOD_JETS, 0);
 
     const float slope = 1.5 / 75;
 
@@ -1196,7 +1427,7 @@ bool SynchSelector::triangularCut(const Event *event)
         && dphi_el_met > (-slope * met_pt + 1.5)
         && dphi_ljet_met < (slope * met_pt + 1.5)
         && dphi_ljet_met > (-slope * met_pt + 1.5)
-        && (_cutflow->apply(TRICUT), true);
+        && (applyCutflow(TRICUT), true);
    
     return tricut()->isInverted() ? !pass : pass;
 }
@@ -1206,9 +1437,9 @@ bool SynchSelector::missingEnergy(const Event *event)
     if (met()->isDisabled())
         return true;
 
-    return goodMET()
-        && met()->apply(pt(*goodMET()))
-        && (_cutflow->apply(MET), true);
+    return _kinematics.hasMET()
+        && met()->apply(_kinematics.metPt())
+        && (applyCutflow(MET), true);
 }
 
 bool SynchSelector::cut2D(const LorentzVector *lepton_p4)
@@ -1216,27 +1447,10 @@ bool SynchSelector::cut2D(const LorentzVector *lepton_p4)
     if (_nice_jets.empty())
         return true;
 
-    GoodJets::const_iterator closest_jet = _nice_jets.end();
-    float deltar_min = 999999;
-
-    for(GoodJets::const_iterator jet = _nice_jets.begin();
-            _nice_jets.end() != jet;
-            ++jet)
-    {
-        const float deltar = dr(*lepton_p4, *jet->corrected_p4);
-        if (deltar < deltar_min)
-        {
-            deltar_min = deltar;
-            closest_jet = jet;
-        }
-    }
-
-    _closest_jet = closest_jet;
-
-    if (_nice_jets.end() == closest_jet)
-        return true;
+    _closest_jet = _nice_jets.begin()
+        + _kinematics.closestJet(EventKinematics::NICE_JETS);
 
-    return _cut2d_selector->apply(*lepton_p4, *closest_jet->corrected_p4);
+    return _cut2d_selector->apply(*lepton_p4, _closest_jet->corrected_p4);
 }
 
 bool SynchSelector::isolation(const LorentzVector *p4, const PFIsolation *isolation)
@@ -1252,6 +1466,44 @@ void SynchSelector::invalidate_cache()
     _btags.invalidate();
 }
 
+void SynchSelector::applyCutflow(const Selection &selection)
+{
+    _cutflow->apply(selection);
+
+    if (!categories())
+        return;
+
+    if (_is_categorized)
+        applyCategoryCutflow(selection);
+    else
+        _event_cuts |= 1u << selection;
+}
+
+void SynchSelector::applyCategoryCutflow(const Selection &selection)
+{
+    const CutflowPtr &cutflow = _category_cutflows[category()];
+
+    cutflow->cut(selection)->setWeight(
+            _cutflow->cut(selection)->events()->weight());
+    cutflow->apply(selection);
+}
+
+void SynchSelector::categorize()
+{
+    if (!categories())
+        return;
+
+    _is_categorized = true;
+
+    // Replay cuts passed before the category was known
+    //
+    for(uint32_t selection = 0; SELECTIONS > selection; ++selection)
+    {
+        if (_event_cuts & (1u << selection))
+            applyCategoryCutflow(static_cast<Selection>(selection));
+    }
+}
+
 void SynchSelector::selectGoodPrimaryVertices(const Event *event)
 {
     typedef ::google::protobuf::RepeatedPtrField<PrimaryVertex> PrimaryVertices;
@@ -1272,14 +1524,28 @@ void SynchSelector::selectGoodElectrons(const Event *event)
 
     const PrimaryVertex &pv = *event->primary_vertex().begin();
 
-    LockSelectorEventCounterOnUpdate lock(*_electron_selector);
+    _electron_arrays.clear();
     for(Electrons::const_iterator electron = event->electron().begin();
             event->electron().end() != electron;
             ++electron)
     {
-        if (!_electron_selector->apply(*electron, pv))
+        _electron_arrays.push_back(*electron, pv);
+    }
+
+    _electron_mask.assign(_electron_arrays.size(), 1);
+    {
+        LockSelectorEventCounterOnUpdate lock(*_electron_selector);
+        if (!_electron_selector->apply(_electron_arrays, _electron_mask))
+            return;
+    }
+
+    for(uint32_t i = 0, size = _electron_mask.size(); size > i; ++i)
+    {
+        if (!_electron_mask[i])
             continue;
 
+        const Electron *electron = &event->electron(i);
+
         typedef ::google::protobuf::RepeatedPtrField<Electron::ElectronID>
             ElectronIDs;
 
@@ -1306,7 +1572,7 @@ void SynchSelector::selectGoodElectrons(const Event *event)
         }
 
         if (is_good_lepton)
-            _good_electrons.push_back(&*electron);
+            _good_electrons.push_back(electron);
     }
 }
 
@@ -1316,13 +1582,25 @@ void SynchSelector::selectGoodMuons(const Event *event)
 
     const PrimaryVertex &pv = *event->primary_vertex().begin();
 
-    LockSelectorEventCounterOnUpdate lock(*_muon_selector);
+    _muon_arrays.clear();
     for(Muons::const_iterator muon = event->muon().begin();
             event->muon().end() != muon;
             ++muon)
     {
-        if (_muon_selector->apply(*muon, pv))
-            _good_muons.push_back(&*muon);
+        _muon_arrays.push_back(*muon, pv);
+    }
+
+    _muon_mask.assign(_muon_arrays.size(), 1);
+    {
+        LockSelectorEventCounterOnUpdate lock(*_muon_selector);
+        if (!_muon_selector->apply(_muon_arrays, _muon_mask))
+            return;
+    }
+
+    for(uint32_t i = 0, size = _muon_mask.size(); size > i; ++i)
+    {
+        if (_muon_mask[i])
+            _good_muons.push_back(&event->muon(i));
     }
 }
 
@@ -25,6 +25,7 @@
 #include "bsm_stat/interface/H2.h"
 #include "interface/CorrectedJet.h"
 #include "interface/Cut.h"
+#include "interface/EventKinematics.h"
 #include "interface/Monitor.h"
 #include "interface/StatProxy.h"
 #include "interface/TemplateAnalyzer.h"
@@ -111,6 +112,78 @@ TemplatesOptions::TemplatesOptions()
          "discrimiantor values in a form: [ltop discriminators]:[htop " +
          "discriminators]. Supported ltop discriminators: mass, drsum. Htop " +
          "discriminators: mass, drsum, dphi. Example: mass:mass,dphi. ").c_str())
+
+        ("compare-reconstructions",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&TemplatesOptions::setReconstructionComparison, this)),
+         "Run all requested reconstructions over the same hypotheses and "
+         "fill per reconstruction histograms")
+
+        ("reconstruction-max-jets",
+         po::value<uint32_t>()->notifier(
+             boost::bind(&TemplatesOptions::setReconstructionMaxJets, this, _1)),
+         "Use only leading jets in reconstruction hypotheses")
+
+        ("event-list",
+         po::value<string>()->notifier(
+             boost::bind(&TemplatesOptions::setEventList, this, _1)),
+         "Save run:lumi:event:mttbar of reconstructed events in file")
+
+        ("event-list-binary",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&TemplatesOptions::setEventListBinary, this)),
+         "Save events list as packed binary entries")
+
+        ("event-list-buffer",
+         po::value<uint32_t>()->notifier(
+             boost::bind(&TemplatesOptions::setEventListBufferSize, this, _1)),
+         "Number of events kept in memory per thread before these are "
+         "written to disk")
+
+        ("summaries",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&TemplatesOptions::setSummaries, this)),
+         "Save mean, rms and quantiles of the output histograms and "
+         "monitors values")
+
+        ("bootstrap",
+         po::value<uint32_t>()->notifier(
+             boost::bind(&TemplatesOptions::setBootstrap, this, _1)),
+         "Fill given number of Poisson bootstrap replicas of the mttbar and "
+         "htlep templates")
+
+        ("categories",
+         po::value<bool>()->implicit_value(true)->notifier(
+             boost::bind(&TemplatesOptions::setCategories, this)),
+         "Select all lepton channels and W+flavors in one pass and save "
+         "histograms per category")
+
+        ("theta-input",
+         po::value<string>()->notifier(
+             boost::bind(&TemplatesOptions::setThetaInput, this, _1)),
+         "Update theta input file with the final mttbar and htlep templates. "
+         "Theta process should be set")
+
+        ("theta-channel",
+         po::value<string>()->notifier(
+             boost::bind(&TemplatesOptions::setThetaChannel, this, _1)),
+         "Theta analysis channel: el (default), mu")
+
+        ("theta-process",
+         po::value<string>()->notifier(
+             boost::bind(&TemplatesOptions::setThetaProcess, this, _1)),
+         "Theta process name: ttbar, wjets, zjets, singletop, zp1000, DATA, "
+         "... QCD template (eleqcd) is not supported")
+
+        ("theta-systematic",
+         po::value<string>()->notifier(
+             boost::bind(&TemplatesOptions::setThetaSystematic, this, _1)),
+         "Theta systematic with direction, e.g. jes+ or pileup-")
+
+        ("theta-scale",
+         po::value<float>()->notifier(
+             boost::bind(&TemplatesOptions::setThetaScale, this, _1)),
+         "Normalize theta templates: x-section * luminosity / events")
     ;
 }
 
@@ -231,6 +304,116 @@ void TemplatesOptions::setReconstructionWithCollimatedTops()
     delegate()->setReconstructionWithCollimatedTops();
 }
 
+void TemplatesOptions::setReconstructionComparison()
+{
+    if (!delegate())
+        return;
+
+    delegate()->setReconstructionComparison();
+}
+
+void TemplatesOptions::setReconstructionMaxJets(const uint32_t &max_jets)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setReconstructionMaxJets(max_jets);
+}
+
+void TemplatesOptions::setEventList(const string &file_name)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setEventList(file_name);
+}
+
+void TemplatesOptions::setEventListBinary()
+{
+    if (!delegate())
+        return;
+
+    delegate()->setEventListBinary();
+}
+
+void TemplatesOptions::setEventListBufferSize(const uint32_t &size)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setEventListBufferSize(size);
+}
+
+void TemplatesOptions::setSummaries()
+{
+    if (!delegate())
+        return;
+
+    delegate()->setSummaries();
+}
+
+void TemplatesOptions::setBootstrap(const uint32_t &replicas)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setBootstrap(replicas);
+}
+
+void TemplatesOptions::setCategories()
+{
+    if (!delegate())
+        return;
+
+    delegate()->setCategories();
+}
+
+void TemplatesOptions::setThetaInput(const string &file_name)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setThetaInput(file_name);
+}
+
+void TemplatesOptions::setThetaChannel(const string &channel)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setThetaChannel(channel);
+}
+
+void TemplatesOptions::setThetaProcess(const string &process)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setThetaProcess(process);
+}
+
+void TemplatesOptions::setThetaSystematic(const string &systematic)
+{
+    if (!delegate())
+        return;
+
+    // Systematic without direction would overwrite nominal template
+    //
+    if (!regex_match(systematic, regex("^\\w+[+-]$")))
+        throw runtime_error("theta systematic should be given with "
+                            "direction, e.g. jes+: " + systematic);
+
+    delegate()->setThetaSystematic(systematic);
+}
+
+void TemplatesOptions::setThetaScale(const float &scale)
+{
+    if (!delegate())
+        return;
+
+    delegate()->setThetaScale(scale);
+}
+
 void TemplatesOptions::setChi2Reconstruction(const string &value)
 {
     if (!delegate())
@@ -364,21 +547,13 @@ TemplatesOptions::Discriminators TemplatesOptions::split(const string &line)
 TemplateAnalyzer::TemplateAnalyzer():
     _use_pileup(false),
     _wjets_input(false),
-    _apply_wjet_correction(false)
+    _apply_wjet_correction(false),
+    _reconstruction_max_jets(0),
+    _compare_reconstructions(false)
 {
     _synch_selector.reset(new SynchSelector());
     monitor(_synch_selector);
 
-    // Assign cutflow delegate
-    //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
-    {
-        Counter *counter = _synch_selector->cutflow()->cut(cut)->events().get();
-        _counters[counter] = cut;
-
-        counter->setDelegate(this);
-    }
-
     _secondary_lepton_counter =
         _synch_selector->cutflow()->cut(
                 SynchSelector::VETO_SECOND_MUON)->objects().get();
@@ -394,10 +569,6 @@ TemplateAnalyzer::TemplateAnalyzer():
                 SynchSelector::HTLEP)->objects().get();
     _htlep_counter->setDelegate(this);
 
-    _cutflow.reset(new H1Proxy(SynchSelector::SELECTIONS, 0,
-                SynchSelector::SELECTIONS));
-    monitor(_cutflow);
-
     _npv.reset(new H1Proxy(25, 0, 25));
     monitor(_npv);
 
@@ -437,7 +608,11 @@ TemplateAnalyzer::TemplateAnalyzer():
     _normalization_mttbar.reset(new H1Proxy(4000, 0, 4));
     monitor(_normalization_mttbar);
 
-    _dr_vs_ptrel.reset(new H2Proxy(100, 0, 100, 15, 0, 1.5));
+    // Large 2D maps are allocated on the first fill: clones that never
+    // fill them stay small
+    //
+    _dr_vs_ptrel.reset(new H2Proxy(100, 0, 100, 15, 0, 1.5,
+                ALLOCATE_ON_FILL));
     monitor(_dr_vs_ptrel);
 
     _ttbar_pt.reset(new H1Proxy(500, 0, 500));
@@ -461,16 +636,20 @@ TemplateAnalyzer::TemplateAnalyzer():
     _met_noweight.reset(new H1Proxy(500, 0, 500));
     monitor(_met_noweight);
 
-    _ljet_met_dphi_vs_met_before_tricut.reset(new H2Proxy(500, 0, 500, 400, 0, 4));
+    _ljet_met_dphi_vs_met_before_tricut.reset(new H2Proxy(500, 0, 500, 400, 0, 4,
+                ALLOCATE_ON_FILL));
     monitor(_ljet_met_dphi_vs_met_before_tricut);
 
-    _lepton_met_dphi_vs_met_before_tricut.reset(new H2Proxy(500, 0, 500, 400, 0, 4));
+    _lepton_met_dphi_vs_met_before_tricut.reset(new H2Proxy(500, 0, 500, 400, 0, 4,
+                ALLOCATE_ON_FILL));
     monitor(_lepton_met_dphi_vs_met_before_tricut);
 
-    _ljet_met_dphi_vs_met.reset(new H2Proxy(500, 0, 500, 400, 0, 4));
+    _ljet_met_dphi_vs_met.reset(new H2Proxy(500, 0, 500, 400, 0, 4,
+                ALLOCATE_ON_FILL));
     monitor(_ljet_met_dphi_vs_met);
 
-    _lepton_met_dphi_vs_met.reset(new H2Proxy(500, 0, 500, 400, 0, 4));
+    _lepton_met_dphi_vs_met.reset(new H2Proxy(500, 0, 500, 400, 0, 4,
+                ALLOCATE_ON_FILL));
     monitor(_lepton_met_dphi_vs_met);
 
     _htop_njets.reset(new H1Proxy(10, 0, 10));
@@ -479,16 +658,20 @@ TemplateAnalyzer::TemplateAnalyzer():
     _htop_delta_r.reset(new H1Proxy(500, 0, 5));
     monitor(_htop_delta_r);
 
-    _htop_njet_vs_m.reset(new H2Proxy(1000, 0, 1, 10, 0, 10));
+    _htop_njet_vs_m.reset(new H2Proxy(1000, 0, 1, 10, 0, 10,
+                ALLOCATE_ON_FILL));
     monitor(_htop_njet_vs_m);
 
-    _htop_pt_vs_m.reset(new H2Proxy(1000, 0, 1, 10, 0, 10));
+    _htop_pt_vs_m.reset(new H2Proxy(1000, 0, 1, 10, 0, 10,
+                ALLOCATE_ON_FILL));
     monitor(_htop_pt_vs_m);
 
-    _htop_pt_vs_njets.reset(new H2Proxy(5, 0, 5, 1000, 0, 1));
+    _htop_pt_vs_njets.reset(new H2Proxy(5, 0, 5, 1000, 0, 1,
+                ALLOCATE_ON_FILL));
     monitor(_htop_pt_vs_njets);
 
-    _htop_pt_vs_ltop_pt.reset(new H2Proxy(1000, 0, 1, 1000, 0, 1));
+    _htop_pt_vs_ltop_pt.reset(new H2Proxy(1000, 0, 1, 1000, 0, 1,
+                ALLOCATE_ON_FILL));
     monitor(_htop_pt_vs_ltop_pt);
 
     _ltop_drsum.reset(new H1Proxy(50, 0, 5));
@@ -591,29 +774,32 @@ TemplateAnalyzer::TemplateAnalyzer():
     _reconstructor.reset(new SimpleResonanceReconstructor());
     monitor(_reconstructor);
 
+    _reconstructions.reset(new MultiResonanceReconstructor());
+    monitor(_reconstructions);
+
+    addReconstruction("simple");
+
     _event_weight.reset(new Cache<float>());
     _event_weight_inverted_htlep.reset(new Cache<float>());
+
+    _events.reset(new EventList());
+    monitor(_events);
+
+    registerOutputs();
 }
 
 TemplateAnalyzer::TemplateAnalyzer(const TemplateAnalyzer &object):
     _use_pileup(false),
     _wjets_input(false),
-    _apply_wjet_correction(object._apply_wjet_correction)
+    _apply_wjet_correction(object._apply_wjet_correction),
+    _reconstruction_max_jets(object._reconstruction_max_jets),
+    _compare_reconstructions(object._compare_reconstructions),
+    _theta_input(object._theta_input)
 {
     _synch_selector = 
         dynamic_pointer_cast<SynchSelector>(object._synch_selector->clone());
     monitor(_synch_selector);
 
-    // Assign cutflow delegate
-    //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
-    {
-        Counter *counter = _synch_selector->cutflow()->cut(cut)->events().get();
-        _counters[counter] = cut;
-
-        counter->setDelegate(this);
-    }
-
     _secondary_lepton_counter =
         _synch_selector->cutflow()->cut(
                 SynchSelector::VETO_SECOND_MUON)->objects().get();
@@ -629,9 +815,6 @@ TemplateAnalyzer::TemplateAnalyzer(const TemplateAnalyzer &object):
                 SynchSelector::HTLEP)->objects().get();
     _htlep_counter->setDelegate(this);
 
-    _cutflow = dynamic_pointer_cast<H1Proxy>(object._cutflow->clone());
-    monitor(_cutflow);
-
     _npv = dynamic_pointer_cast<H1Proxy>(object._npv->clone());
     monitor(_npv);
 
@@ -841,6 +1024,20 @@ TemplateAnalyzer::TemplateAnalyzer(const TemplateAnalyzer &object):
         dynamic_pointer_cast<H1Proxy>(object._njet2_dr_lepton_jet2_after_reconstruction->clone());
     monitor(_njet2_dr_lepton_jet2_after_reconstruction);
 
+    cloneHistograms(_category_njets, object._category_njets);
+    cloneHistograms(_category_met, object._category_met);
+    cloneHistograms(_category_htlep_after_htlep,
+                    object._category_htlep_after_htlep);
+    cloneHistograms(_category_mttbar_after_htlep,
+                    object._category_mttbar_after_htlep);
+
+    cloneHistograms(_category_htlep_before_htlep,
+                    object._category_htlep_before_htlep);
+    cloneHistograms(_category_htlep_before_htlep_noweight,
+                    object._category_htlep_before_htlep_noweight);
+    cloneHistograms(_category_mttbar_before_htlep,
+                    object._category_mttbar_before_htlep);
+
     _pileup =
         dynamic_pointer_cast<Pileup>(object._pileup->clone());
     monitor(_pileup);
@@ -849,115 +1046,318 @@ TemplateAnalyzer::TemplateAnalyzer(const TemplateAnalyzer &object):
         dynamic_pointer_cast<ResonanceReconstructor>(object._reconstructor->clone());
     monitor(_reconstructor);
 
+    _reconstructions = dynamic_pointer_cast<MultiResonanceReconstructor>(
+            object._reconstructions->clone());
+    monitor(_reconstructions);
+
+    _reconstruction_names = object._reconstruction_names;
+
+    cloneHistograms(_reconstruction_mttbar, object._reconstruction_mttbar);
+    cloneHistograms(_reconstruction_ltop_mass,
+                    object._reconstruction_ltop_mass);
+    cloneHistograms(_reconstruction_htop_mass,
+                    object._reconstruction_htop_mass);
+    cloneHistograms(_reconstruction_htop_njets,
+                    object._reconstruction_htop_njets);
+
     _event_weight.reset(new Cache<float>());
     _event_weight_inverted_htlep.reset(new Cache<float>());
+
+    _events = dynamic_pointer_cast<EventList>(object._events->clone());
+    monitor(_events);
+
+    _bootstrap = object._bootstrap;
+    if (_bootstrap.isEnabled())
+    {
+        _bootstrap_mttbar_before_htlep = dynamic_pointer_cast<BootstrapH1>(
+                object._bootstrap_mttbar_before_htlep->clone());
+        monitor(_bootstrap_mttbar_before_htlep);
+
+        _bootstrap_mttbar_after_htlep = dynamic_pointer_cast<BootstrapH1>(
+                object._bootstrap_mttbar_after_htlep->clone());
+        monitor(_bootstrap_mttbar_after_htlep);
+
+        _bootstrap_htlep_before_htlep = dynamic_pointer_cast<BootstrapH1>(
+                object._bootstrap_htlep_before_htlep->clone());
+        monitor(_bootstrap_htlep_before_htlep);
+
+        _bootstrap_htlep_after_htlep = dynamic_pointer_cast<BootstrapH1>(
+                object._bootstrap_htlep_after_htlep->clone());
+        monitor(_bootstrap_htlep_after_htlep);
+    }
+
+    registerOutputs();
 }
 
 void TemplateAnalyzer::setBtagReconstruction()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new BtagResonanceReconstructor());
-    monitor(_reconstructor);
+    setReconstructor(new BtagResonanceReconstructor(), "btag");
 }
 
 void TemplateAnalyzer::setSimpleDrReconstruction()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new SimpleDrResonanceReconstructor());
-    monitor(_reconstructor);
+    setReconstructor(new SimpleDrResonanceReconstructor(), "simple_dr");
 }
 
 void TemplateAnalyzer::setHemisphereReconstruction()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new HemisphereResonanceReconstructor());
-    monitor(_reconstructor);
+    setReconstructor(new HemisphereResonanceReconstructor(), "hemisphere");
 }
 
 void TemplateAnalyzer::setReconstructionWithMass()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new ResonanceReconstructorWithMass());
-    monitor(_reconstructor);
+    setReconstructor(new ResonanceReconstructorWithMass(), "mass");
 }
 
 void TemplateAnalyzer::setReconstructionWithPhi()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new ResonanceReconstructorWithPhi());
-    monitor(_reconstructor);
+    setReconstructor(new ResonanceReconstructorWithPhi(), "phi");
 }
 
 void TemplateAnalyzer::setReconstructionWithMassAndPhi()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new ResonanceReconstructorWithMassAndPhi());
-    monitor(_reconstructor);
+    setReconstructor(new ResonanceReconstructorWithMassAndPhi(), "mass_phi");
 }
 
 void TemplateAnalyzer::setSimpleReconstructionWithMassAndPhi()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new SimpleResonanceReconstructorWithMassAndPhi());
-    monitor(_reconstructor);
+    setReconstructor(new SimpleResonanceReconstructorWithMassAndPhi(), "simple_mass_phi");
 }
 
 void TemplateAnalyzer::setSimpleReconstructionWithMass()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new SimpleResonanceReconstructorWithMass());
-    monitor(_reconstructor);
+    setReconstructor(new SimpleResonanceReconstructorWithMass(), "simple_mass");
 }
 
 void TemplateAnalyzer::setCollimatedSimpleReconstructionWithMass()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new CollimatedSimpleResonanceReconstructorWithMass());
-    monitor(_reconstructor);
+    setReconstructor(new CollimatedSimpleResonanceReconstructorWithMass(), "collimated_simple_mass");
 }
 
 void TemplateAnalyzer::setCollimatedSimpleReconstructionWithTopMass()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new CollimatedSimpleResonanceReconstructorWithTopMass());
-    monitor(_reconstructor);
+    setReconstructor(new CollimatedSimpleResonanceReconstructorWithTopMass(), "collimated_simple_top_mass");
 }
 
 void TemplateAnalyzer::setReconstructionWithCollimatedTops()
 {
-    stopMonitor(_reconstructor);
-
-    _reconstructor.reset(new ResonanceReconstructorWithCollimatedTops());
-    monitor(_reconstructor);
+    setReconstructor(new ResonanceReconstructorWithCollimatedTops(), "collimated_tops");
 }
 
 void TemplateAnalyzer::setChi2Reconstruction(const Chi2Discriminators &ltop,
                                              const Chi2Discriminators &htop)
 {
-    stopMonitor(_reconstructor);
-
     Chi2ResonanceReconstructor *reco = new Chi2ResonanceReconstructor();
     reco->setLtopDiscriminators(ltop);
     reco->setHtopDiscriminators(htop);
 
-    _reconstructor.reset(reco);
+    setReconstructor(reco, "chi2");
+}
 
-    monitor(_reconstructor);
+void TemplateAnalyzer::setReconstructionMaxJets(const uint32_t &max_jets)
+{
+    _reconstruction_max_jets = max_jets;
+    _reconstructor->setMaxJets(max_jets);
+    _reconstructions->setMaxJets(max_jets);
+}
+
+void TemplateAnalyzer::setReconstructionComparison()
+{
+    // Reconstructions added later are registered on the way
+    //
+    if (_compare_reconstructions)
+        return;
+
+    _compare_reconstructions = true;
+
+    for(uint32_t reconstruction = 0;
+            reconstructions() > reconstruction;
+            ++reconstruction)
+    {
+        registerReconstructionOutputs(reconstruction);
+    }
+}
+
+void TemplateAnalyzer::setEventList(const string &file_name)
+{
+    _events->setFile(file_name);
+}
+
+void TemplateAnalyzer::setEventListBinary()
+{
+    _events->setFormat(EventList::BINARY);
+}
+
+void TemplateAnalyzer::setEventListBufferSize(const uint32_t &size)
+{
+    _events->setBufferSize(size);
+}
+
+void TemplateAnalyzer::setSummaries()
+{
+    _outputs.enableSummaries();
+}
+
+void TemplateAnalyzer::setBootstrap(const uint32_t &replicas)
+{
+    // Replicas are booked once: options are applied before analyzer is
+    // cloned for threads
+    //
+    if (_bootstrap.isEnabled()
+            || !replicas)
+        return;
+
+    _bootstrap = Bootstrap(replicas);
+
+    _bootstrap_mttbar_before_htlep.reset(
+            new BootstrapH1(replicas, 4000, 0, 4));
+    monitor(_bootstrap_mttbar_before_htlep);
+
+    _bootstrap_mttbar_after_htlep.reset(new BootstrapH1(replicas, 4000, 0, 4));
+    monitor(_bootstrap_mttbar_after_htlep);
+
+    _bootstrap_htlep_before_htlep.reset(
+            new BootstrapH1(replicas, 50, 100, 150));
+    monitor(_bootstrap_htlep_before_htlep);
+
+    _bootstrap_htlep_after_htlep.reset(new BootstrapH1(replicas, 500, 0, 500));
+    monitor(_bootstrap_htlep_after_htlep);
+
+    registerBootstrapOutputs();
+}
+
+void TemplateAnalyzer::setCategories()
+{
+    // Category histograms are booked once and only if requested: options
+    // are applied before analyzer is cloned for threads
+    //
+    if (_synch_selector->categories())
+        return;
+
+    _synch_selector->setCategories(true);
+
+    bookCategories(_category_njets, 15, 0, 15);
+    bookCategories(_category_met, 500, 0, 500);
+    bookCategories(_category_htlep_after_htlep, 500, 0, 500);
+    bookCategories(_category_mttbar_after_htlep, 4000, 0, 4);
+
+    bookCategories(_category_htlep_before_htlep, 50, 100, 150);
+    bookCategories(_category_htlep_before_htlep_noweight, 50, 100, 150);
+    bookCategories(_category_mttbar_before_htlep, 4000, 0, 4);
+
+    registerCategoryOutputs();
+}
+
+bool TemplateAnalyzer::saveEventList()
+{
+    return !_events->isEnabled()
+        || _events->save();
+}
+
+void TemplateAnalyzer::setThetaInput(const string &file_name)
+{
+    _theta_input.setFile(file_name);
+}
+
+void TemplateAnalyzer::setThetaChannel(const string &channel)
+{
+    _theta_input.setChannel(channel);
+}
+
+void TemplateAnalyzer::setThetaProcess(const string &process)
+{
+    _theta_input.setProcess(process);
+}
+
+void TemplateAnalyzer::setThetaSystematic(const string &systematic)
+{
+    _theta_input.setSystematic(systematic);
+}
+
+void TemplateAnalyzer::setThetaScale(const float &scale)
+{
+    _theta_input.setScale(scale);
+}
+
+bool TemplateAnalyzer::saveThetaInput()
+{
+    if (!_theta_input.isEnabled())
+        return true;
+
+    // Final binning of the limit setting: 100 GeV in mttbar, 25 GeV in htlep.
+    // Plot names follow python/theta: only mttbar_after_htlep is renamed
+    //
+    ThetaInput::Templates templates;
+    templates.push_back(ThetaInput::Template("mttbar",
+                                             _mttbar_after_htlep,
+                                             100));
+
+    templates.push_back(ThetaInput::Template("htlep_after_htlep",
+                                             _htlep_after_htlep,
+                                             25));
+
+    return _theta_input.save(templates);
+}
+
+bool TemplateAnalyzer::compareReconstructions() const
+{
+    return _compare_reconstructions;
+}
+
+uint32_t TemplateAnalyzer::reconstructions() const
+{
+    return _reconstruction_names.size();
+}
+
+string TemplateAnalyzer::reconstructionName(const uint32_t &reconstruction) const
+{
+    return _reconstruction_names[reconstruction];
+}
+
+const TemplateAnalyzer::H1Ptr
+    TemplateAnalyzer::reconstructionMttbar(const uint32_t &reconstruction) const
+{
+    return _reconstruction_mttbar[reconstruction]->histogram();
+}
+
+const TemplateAnalyzer::H1Ptr
+    TemplateAnalyzer::reconstructionLtopMass(const uint32_t &reconstruction) const
+{
+    return _reconstruction_ltop_mass[reconstruction]->histogram();
+}
+
+const TemplateAnalyzer::H1Ptr
+    TemplateAnalyzer::reconstructionHtopMass(const uint32_t &reconstruction) const
+{
+    return _reconstruction_htop_mass[reconstruction]->histogram();
+}
+
+const TemplateAnalyzer::H1Ptr
+    TemplateAnalyzer::reconstructionHtopNjets(const uint32_t &reconstruction) const
+{
+    return _reconstruction_htop_njets[reconstruction]->histogram();
 }
 
 const TemplateAnalyzer::H1Ptr TemplateAnalyzer::cutflow() const
 {
-    return _cutflow->histogram();
+    // Weighted cutflow is kept by the selector counters
+    //
+    H1Ptr cutflow(new stat::H1(SynchSelector::SELECTIONS, 0,
+                SynchSelector::SELECTIONS));
+
+    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
+    {
+        const CounterPtr events = _synch_selector->cutflow()->cut(cut)->events();
+        if (events->counts())
+            cutflow->fill(cut, events->sumOfWeights());
+    }
+
+    return cutflow;
+}
+
+const bsm::OutputRegistry *TemplateAnalyzer::outputs() const
+{
+    return &_outputs;
 }
 
 const TemplateAnalyzer::H1Ptr TemplateAnalyzer::npv() const
@@ -1220,6 +1620,30 @@ const TemplateAnalyzer::P4MonitorPtr TemplateAnalyzer::ltopJet1() const
     return _ltop_jet1;
 }
 
+bool TemplateAnalyzer::categories() const
+{
+    return _synch_selector->categories();
+}
+
+const TemplateAnalyzer::H1Ptr
+    TemplateAnalyzer::cutflow(const uint32_t &category) const
+{
+    H1Ptr cutflow(new stat::H1(SynchSelector::SELECTIONS, 0,
+                SynchSelector::SELECTIONS));
+
+    const SynchSelector::CutflowPtr category_cutflow =
+        _synch_selector->cutflow(category);
+
+    for(uint32_t cut = 0; SynchSelector::SELECTIONS > cut; ++cut)
+    {
+        const CounterPtr events = category_cutflow->cut(cut)->events();
+        if (events->counts())
+            cutflow->fill(cut, events->sumOfWeights());
+    }
+
+    return cutflow;
+}
+
 const TemplateAnalyzer::H1Ptr TemplateAnalyzer::njetsBeforeReconstruction() const
 {
     return _njets_before_reconstruction->histogram();
@@ -1291,26 +1715,22 @@ void TemplateAnalyzer::didCounterAdd(const Counter *counter)
     if (_event_weight->is_invalid())
         return;
 
-    if (_counters.end() != _counters.find(counter))
-        cutflow()->fill(_counters[counter], *_event_weight);
-
     if (counter == _secondary_lepton_counter)
         fillDrVsPtrel();
     else if (counter == _htlep_counter)
     {
-        const LorentzVector &el_p4 =
-            (*_synch_selector->goodElectrons().begin())->physics_object().p4();
+        const LorentzVector &el_p4 = leptonP4();
 
         _electron_before_tricut->fill(el_p4, *_event_weight);
 
-        const LorentzVector &missing_energy = *_synch_selector->goodMET();
+        const EventKinematics &kinematics = _synch_selector->kinematics();
 
-        ljetMetDphivsMetBeforeTricut()->fill(pt(missing_energy),
-                fabs(dphi(*_synch_selector->goodJets()[0].corrected_p4, missing_energy)),
+        _ljet_met_dphi_vs_met_before_tricut->fill(kinematics.metPt(),
+                kinematics.jetMetDphi(EventKinematics::GOOD_JETS, 0),
                 *_event_weight);
 
-        leptonMetDphivsMetBeforeTricut()->fill(pt(missing_energy),
-                fabs(dphi(el_p4, missing_energy)),
+        _lepton_met_dphi_vs_met_before_tricut->fill(kinematics.metPt(),
+                kinematics.leptonMetDphi(),
                 *_event_weight);
     }
 }
@@ -1377,6 +1797,10 @@ void TemplateAnalyzer::process(const Event *event)
 
     _event_weight_inverted_htlep->set(*_event_weight);
 
+    _synch_selector->cutflow()->setWeight(*_event_weight);
+    _synch_selector_with_inverted_htlep->cutflow()->setWeight(
+            *_event_weight_inverted_htlep);
+
     // Process only events, that pass the synch selector
     //
     if (_synch_selector->apply(event))
@@ -1386,28 +1810,41 @@ void TemplateAnalyzer::process(const Event *event)
         {
             _event_weight->set(*_event_weight *
                                _synch_selector->countBtaggedJets().second);
+
+            _synch_selector->cutflow()->setWeight(*_event_weight);
         }
 
         fill_btag();
 
-        njetsBeforeReconstruction()->fill(_synch_selector->goodJets().size(),
-                                          *_event_weight);
+        _njets_before_reconstruction->fill(_synch_selector->goodJets().size(),
+                                           *_event_weight);
 
         if (2 == _synch_selector->goodJets().size())
         {
-            const LorentzVector &el_p4 =
-                _synch_selector->goodElectrons()[0]->physics_object().p4();
+            const EventKinematics &kinematics = _synch_selector->kinematics();
 
-            njet2DrLeptonJet1BeforeReconstruction()->fill(
-                    dr(el_p4, *_synch_selector->goodJets()[0].corrected_p4),
+            _njet2_dr_lepton_jet1_before_reconstruction->fill(
+                    kinematics.leptonJetDr(EventKinematics::GOOD_JETS, 0),
                     *_event_weight);
 
-            njet2DrLeptonJet2BeforeReconstruction()->fill(
-                    dr(el_p4, *_synch_selector->goodJets()[1].corrected_p4),
+            _njet2_dr_lepton_jet2_before_reconstruction->fill(
+                    kinematics.leptonJetDr(EventKinematics::GOOD_JETS, 1),
                     *_event_weight);
         }
 
-        Mttbar resonance = mttbar();
+        Mttbar resonance;
+        if (_compare_reconstructions)
+        {
+            // All reconstructors share one hypotheses enumeration. The last
+            // one is the selected reconstructor
+            //
+            const Mttbars resonances = mttbars();
+            fillReconstructions(resonances);
+
+            resonance = resonances.back();
+        }
+        else
+            resonance = mttbar();
 
         if (_synch_selector->reconstruction(resonance.valid) &&
             _synch_selector->ltop(pt(resonance.ltop)))
@@ -1415,20 +1852,34 @@ void TemplateAnalyzer::process(const Event *event)
             if (_synch_selector->chi2(resonance.ltop_discriminator +
                                       resonance.htop_discriminator))
             {
-                _out << event->extra().run() << ":"
-                     << event->extra().lumi() << ":"
-                     << event->extra().id() << ":"
-                     << mass(resonance.mttbar) << endl;
+                _events->add(event->extra().run(),
+                             event->extra().lumi(),
+                             event->extra().id(),
+                             mass(resonance.mttbar));
+
+                if (_bootstrap.isEnabled())
+                {
+                    _bootstrap.setEvent(event->extra().run(),
+                                        event->extra().lumi(),
+                                        event->extra().id());
+
+                    _bootstrap_mttbar_after_htlep->fill(_bootstrap,
+                            mass(resonance.mttbar) / 1000,
+                            *_event_weight);
+
+                    _bootstrap_htlep_after_htlep->fill(_bootstrap,
+                            htlepValue(),
+                            *_event_weight);
+                }
 
-                const LorentzVector &el_p4 =
-                    _synch_selector->goodElectrons()[0]->physics_object().p4();
+                const LorentzVector &el_p4 = leptonP4();
 
                 // fill ltop drsum
                 //
-                ltop_drsum()->fill(dr(resonance.ltop, el_p4) +
+                _ltop_drsum->fill(dr(resonance.ltop, el_p4) +
                                        dr(resonance.ltop, resonance.neutrino) +
                                        dr(resonance.ltop, resonance.ltop_jet),
-                                   *_event_weight);
+                                  *_event_weight);
 
                 if (1 < resonance.htop_jets.size())
                 {
@@ -1438,10 +1889,10 @@ void TemplateAnalyzer::process(const Event *event)
                             resonance.htop_jets.end() != jet;
                             ++jet)
                     {
-                        drsum += dr(resonance.htop, *jet->corrected_p4);
+                        drsum += dr(resonance.htop, jet->corrected_p4);
                     }
 
-                    htop_drsum()->fill(drsum, *_event_weight);
+                    _htop_drsum->fill(drsum, *_event_weight);
                 }
 
                 switch(resonance.htop_jets.size())
@@ -1453,28 +1904,28 @@ void TemplateAnalyzer::process(const Event *event)
                              break;
                 }
 
-                htop_dphi()->fill(dphi(resonance.htop, resonance.ltop),
-                                  *_event_weight);
+                _htop_dphi->fill(dphi(resonance.htop, resonance.ltop),
+                                 *_event_weight);
 
-                chi2()->fill(resonance.ltop_discriminator +
+                _chi2->fill(resonance.ltop_discriminator +
                                 resonance.htop_discriminator,
-                             *_event_weight);
+                            *_event_weight);
 
-                ltop_chi2()->fill(resonance.ltop_discriminator,
-                                  *_event_weight);
+                _ltop_chi2->fill(resonance.ltop_discriminator,
+                                 *_event_weight);
 
-                htop_chi2()->fill(resonance.htop_discriminator,
-                                  *_event_weight);
+                _htop_chi2->fill(resonance.htop_discriminator,
+                                 *_event_weight);
 
-                mttbarAfterHtlep()->fill(mass(resonance.mttbar) / 1000,
-                                         *_event_weight);
+                _mttbar_after_htlep->fill(mass(resonance.mttbar) / 1000,
+                                          *_event_weight);
 
-                ttbarPt()->fill(pt(resonance.mttbar), *_event_weight);
+                _ttbar_pt->fill(pt(resonance.mttbar), *_event_weight);
 
-                wlepMt()->fill(mt(resonance.neutrino, el_p4), *_event_weight);
+                _wlep_mt->fill(mt(resonance.neutrino, el_p4), *_event_weight);
 
-                wlepMass()->fill(mass(resonance.wlep), *_event_weight);
-                whadMass()->fill(mass(resonance.whad), *_event_weight);
+                _wlep_mass->fill(mass(resonance.wlep), *_event_weight);
+                _whad_mass->fill(mass(resonance.whad), *_event_weight);
 
                 monitorJets();
 
@@ -1483,107 +1934,130 @@ void TemplateAnalyzer::process(const Event *event)
                 _ltop->fill(resonance.ltop, *_event_weight);
                 _htop->fill(resonance.htop, *_event_weight);
                 
-                npv()->fill(event->primary_vertex().size());
+                _npv->fill(event->primary_vertex().size());
 
-                npvWithPileup()->fill(event->primary_vertex().size(),
-                                      *_event_weight);
+                _npv_with_pileup->fill(event->primary_vertex().size(),
+                                       *_event_weight);
 
-                njets()->fill(_synch_selector->goodJets().size(),
-                              *_event_weight);
+                _njets->fill(_synch_selector->goodJets().size(),
+                             *_event_weight);
 
                 const LorentzVector &missing_energy = *_synch_selector->goodMET();
-                ljetMetDphivsMet()->fill(
+                _ljet_met_dphi_vs_met->fill(
                         pt(missing_energy),
-                        fabs(dphi(*_synch_selector->goodJets()[0].corrected_p4,
+                        fabs(dphi(_synch_selector->goodJets()[0].corrected_p4,
                                   missing_energy)),
                         *_event_weight);
 
-                met()->fill(pt(missing_energy), *_event_weight);
-                metNoWeight()->fill(pt(missing_energy));
+                _met->fill(pt(missing_energy), *_event_weight);
+                _met_noweight->fill(pt(missing_energy));
 
-                htopNjets()->fill(resonance.htop_jets.size(), *_event_weight);
+                _htop_njets->fill(resonance.htop_jets.size(), *_event_weight);
 
                 const ResonanceReconstructor::CorrectedJets &htop_jets =
                     resonance.htop_jets;
 
                 if (1 < htop_jets.size())
                 {
-                    htopDeltaR()->fill(dr(*htop_jets[0].corrected_p4,
-                                          *htop_jets[1].corrected_p4),
-                                       *_event_weight);
+                    _htop_delta_r->fill(dr(htop_jets[0].corrected_p4,
+                                           htop_jets[1].corrected_p4),
+                                        *_event_weight);
                 }
 
-                htopNjetvsM()->fill(mass(resonance.htop),
-                                    resonance.htop_njets,
+                _htop_njet_vs_m->fill(mass(resonance.htop),
+                                      resonance.htop_njets,
+                                      *_event_weight);
+
+                _htop_pt_vs_m->fill(mass(resonance.htop),
+                                    pt(resonance.htop),
                                     *_event_weight);
 
-                htopPtvsM()->fill(mass(resonance.htop),
-                                  pt(resonance.htop),
-                                  *_event_weight);
+                _htop_pt_vs_njets->fill(resonance.htop_njets,
+                                        pt(resonance.htop),
+                                        *_event_weight);
 
-                htopPtvsNjets()->fill(resonance.htop_njets,
-                                      pt(resonance.htop),
-                                      *_event_weight);
+                _htop_pt_vs_ltop_pt->fill(pt(resonance.ltop),
+                                          pt(resonance.htop),
+                                          *_event_weight);
 
-                htopPtvsLtoppt()->fill(pt(resonance.ltop),
-                                       pt(resonance.htop),
-                                       *_event_weight);
+                _lepton_met_dphi_vs_met->fill(pt(missing_energy),
+                                              fabs(dphi(el_p4, missing_energy)),
+                                              *_event_weight);
 
-                leptonMetDphivsMet()->fill(pt(missing_energy),
-                                           fabs(dphi(el_p4, missing_energy)),
-                                           *_event_weight);
+                _htlep->fill(htlepValue(), *_event_weight);
+                _htall->fill(htallValue(), *_event_weight);
+
+                _htlep_after_htlep->fill(htlepValue(), *_event_weight);
 
-                htlep()->fill(htlepValue(), *_event_weight);
-                htall()->fill(htallValue(), *_event_weight);
+                if (_synch_selector->categories())
+                {
+                    const uint32_t category = _synch_selector->category();
+
+                    _category_njets.at(category)->fill(
+                            _synch_selector->goodJets().size(),
+                            *_event_weight);
 
-                htlepAfterHtlep()->fill(htlepValue(), *_event_weight);
+                    _category_met.at(category)->fill(pt(missing_energy),
+                                                     *_event_weight);
 
-                solutions()->fill(resonance.solutions);
+                    _category_htlep_after_htlep.at(category)->fill(
+                            htlepValue(),
+                            *_event_weight);
+
+                    _category_mttbar_after_htlep.at(category)->fill(
+                            mass(resonance.mttbar) / 1000,
+                            *_event_weight);
+                }
+
+                _solutions->fill(resonance.solutions);
 
                 if (0 < htop_jets.size())
                 {
-                    htopJet1()->fill(*htop_jets[0].corrected_p4,
+                    htopJet1()->fill(htop_jets[0].corrected_p4,
                                      *_event_weight);
                 }
                 
                 if (1 < htop_jets.size())
                 {
-                    htopJet2()->fill(*htop_jets[1].corrected_p4,
+                    htopJet2()->fill(htop_jets[1].corrected_p4,
                                      *_event_weight);
                 }
 
                 if (2 < htop_jets.size())
                 {
-                    htopJet3()->fill(*htop_jets[2].corrected_p4,
+                    htopJet3()->fill(htop_jets[2].corrected_p4,
                                      *_event_weight);
                 }
 
                 if (3 < htop_jets.size())
                 {
-                    htopJet4()->fill(*htop_jets[3].corrected_p4,
+                    htopJet4()->fill(htop_jets[3].corrected_p4,
                                      *_event_weight);
                 }
 
                 ltopJet1()->fill(resonance.ltop_jet, *_event_weight);
 
-                njetsAfterReconstruction()->fill(_synch_selector->goodJets().size(),
-                                                 *_event_weight);
+                _njets_after_reconstruction->fill(_synch_selector->goodJets().size(),
+                                                  *_event_weight);
 
                 if (2 == _synch_selector->goodJets().size())
                 {
-                    njet2DrLeptonJet1AfterReconstruction()->fill(
-                            dr(el_p4, *_synch_selector->goodJets()[0].corrected_p4),
+                    const EventKinematics &kinematics =
+                        _synch_selector->kinematics();
+
+                    _njet2_dr_lepton_jet1_after_reconstruction->fill(
+                            kinematics.leptonJetDr(EventKinematics::GOOD_JETS, 0),
                             *_event_weight);
 
-                    njet2DrLeptonJet2AfterReconstruction()->fill(
-                            dr(el_p4, *_synch_selector->goodJets()[1].corrected_p4),
+                    _njet2_dr_lepton_jet2_after_reconstruction->fill(
+                            kinematics.leptonJetDr(EventKinematics::GOOD_JETS, 1),
                             *_event_weight);
                 }
             }
             else
             {
-                normalization_mttbar()->fill(mass(resonance.mttbar) / 1000,
-                                             *_event_weight);
+                _normalization_mttbar->fill(mass(resonance.mttbar) / 1000,
+                                            *_event_weight);
             }
         }
     }
@@ -1598,6 +2072,9 @@ void TemplateAnalyzer::process(const Event *event)
             _event_weight_inverted_htlep->set(
                     *_event_weight_inverted_htlep *
                     _synch_selector_with_inverted_htlep->countBtaggedJets().second);
+
+            _synch_selector_with_inverted_htlep->cutflow()->setWeight(
+                    *_event_weight_inverted_htlep);
         }
 
         Mttbar resonance = mttbar();
@@ -1607,12 +2084,44 @@ void TemplateAnalyzer::process(const Event *event)
                 _synch_selector_with_inverted_htlep->chi2(resonance.ltop_discriminator +
                                                           resonance.htop_discriminator))
         {
-            htlep()->fill(htlepValue(), *_event_weight_inverted_htlep);
-            htlepBeforeHtlep()->fill(htlepValue(),
-                                     *_event_weight_inverted_htlep);
-            htlepBeforeHtlepNoWeight()->fill(htlepValue());
-            mttbarBeforeHtlep()->fill(mass(mttbar().mttbar) / 1000,
+            _htlep->fill(htlepValue(), *_event_weight_inverted_htlep);
+            _htlep_before_htlep->fill(htlepValue(),
                                       *_event_weight_inverted_htlep);
+            _htlep_before_htlep_noweight->fill(htlepValue());
+            _mttbar_before_htlep->fill(mass(mttbar().mttbar) / 1000,
+                                       *_event_weight_inverted_htlep);
+
+            if (_synch_selector_with_inverted_htlep->categories())
+            {
+                const uint32_t category =
+                    _synch_selector_with_inverted_htlep->category();
+
+                _category_htlep_before_htlep.at(category)->fill(
+                        htlepValue(),
+                        *_event_weight_inverted_htlep);
+
+                _category_htlep_before_htlep_noweight.at(category)->fill(
+                        htlepValue());
+
+                _category_mttbar_before_htlep.at(category)->fill(
+                        mass(mttbar().mttbar) / 1000,
+                        *_event_weight_inverted_htlep);
+            }
+
+            if (_bootstrap.isEnabled())
+            {
+                _bootstrap.setEvent(event->extra().run(),
+                                    event->extra().lumi(),
+                                    event->extra().id());
+
+                _bootstrap_htlep_before_htlep->fill(_bootstrap,
+                        htlepValue(),
+                        *_event_weight_inverted_htlep);
+
+                _bootstrap_mttbar_before_htlep->fill(_bootstrap,
+                        mass(mttbar().mttbar) / 1000,
+                        *_event_weight_inverted_htlep);
+            }
         }
     } 
 
@@ -1640,19 +2149,9 @@ void TemplateAnalyzer::merge(const ObjectPtr &pointer)
     if (!object)
         return;
 
-    _secondary_lepton_counter->setDelegate(0);
-    _leading_jet_counter->setDelegate(0);
-    _htlep_counter->setDelegate(0);
-
-    // Reset counter delegates
+    // Note: counters do not notify delegates on merge
     //
-    for(uint32_t cut = 0; SynchSelector::SELECTIONS < cut; ++cut)
-        _synch_selector->cutflow()->cut(cut)->events().get()->setDelegate(0);
-
     Object::merge(pointer);
-
-    _out << endl;
-    _out << object->_out.str();
 }
 
 void TemplateAnalyzer::print(std::ostream &out) const
@@ -1660,10 +2159,18 @@ void TemplateAnalyzer::print(std::ostream &out) const
     out << "Reconstructor: " << *_reconstructor << endl;
     out << endl;
 
+    if (_compare_reconstructions)
+    {
+        out << "Compared reconstructors: " << *_reconstructions << endl;
+        out << endl;
+    }
+
     out << *_synch_selector << endl;
 
-    out << "Reconstructed events list" << endl;
-    out << _out.str() << endl;
+    out << *_events << endl;
+
+    if (_bootstrap.isEnabled())
+        out << *_bootstrap_mttbar_after_htlep << endl;
 }
 
 // Private
@@ -1672,45 +2179,33 @@ void TemplateAnalyzer::fillDrVsPtrel()
 {
     // Secondary lepton veto cut passed: find closest jet to the lepton
     //
-    const LorentzVector &lepton_p4 =
-        (SynchSelector::ELECTRON == _synch_selector->leptonMode()
-            ? (*_synch_selector->goodElectrons().begin())->physics_object().p4()
-            : (*_synch_selector->goodMuons().begin())->physics_object().p4());
-
-    typedef SynchSelector::GoodJets GoodJets;
+    const LorentzVector &lepton_p4 = leptonP4();
 
-    const GoodJets &nice_jets = _synch_selector->niceJets();
-    GoodJets::const_iterator closest_jet = nice_jets.end();
-    float deltar_min = 999999;
-
-    for(GoodJets::const_iterator jet = nice_jets.begin();
-            nice_jets.end() != jet;
-            ++jet)
-    {
-        const float deltar = dr(lepton_p4, *jet->corrected_p4);
-        if (deltar < deltar_min)
-        {
-            deltar_min = deltar;
-            closest_jet = jet;
-        }
-    }
-
-    if (nice_jets.end() == closest_jet)
+    const SynchSelector::GoodJets &nice_jets = _synch_selector->niceJets();
+    if (nice_jets.empty())
         return;
 
-    const float ptrel_value = ptrel(lepton_p4, *closest_jet->corrected_p4);
-    drVsPtrel()->fill(ptrel_value, deltar_min,  *_event_weight);
+    const EventKinematics &kinematics = _synch_selector->kinematics();
+    const uint32_t closest_jet =
+        kinematics.closestJet(EventKinematics::NICE_JETS);
+
+    const float ptrel_value = ptrel(lepton_p4,
+                                    nice_jets[closest_jet].corrected_p4);
+    _dr_vs_ptrel->fill(ptrel_value,
+                       kinematics.leptonJetDr(EventKinematics::NICE_JETS,
+                                             closest_jet),
+                       *_event_weight);
 
     if (5 > ptrel_value)
     {
         if (SynchSelector::ELECTRON == _synch_selector->leptonMode())
         {
-            d0()->fill((*_synch_selector->goodElectrons().begin())->extra().d0(),
+            _d0->fill((*_synch_selector->goodElectrons().begin())->extra().d0(),
                     *_event_weight);
         }
         else
         {
-            d0()->fill((*_synch_selector->goodMuons().begin())->extra().d0(),
+            _d0->fill((*_synch_selector->goodMuons().begin())->extra().d0(),
                     *_event_weight);
         }
     }
@@ -1726,148 +2221,456 @@ TemplateAnalyzer::Mttbar TemplateAnalyzer::mttbar() const
         return Mttbar();
     }
 
-    // Note: leptons are kept in a vector of pointers
-    //
-    const LorentzVector &lepton_p4 =
-        SynchSelector::ELECTRON == _synch_selector->leptonMode()
-        ? (*_synch_selector->goodElectrons().begin())->physics_object().p4()
-        : (*_synch_selector->goodMuons().begin())->physics_object().p4();
-
-    return _reconstructor->run(lepton_p4,
+    return _reconstructor->run(leptonP4(),
                                *_synch_selector->goodMET(),
                                _synch_selector->goodJets());
 }
 
+TemplateAnalyzer::Mttbars TemplateAnalyzer::mttbars() const
+{
+    if (10 < _synch_selector->goodJets().size())
+    {
+        clog << _synch_selector->goodJets().size()
+            << " good jets are found: skip hypothesis generation" << endl;
+
+        return Mttbars(_reconstructions->reconstructors().size());
+    }
+
+    return _reconstructions->run(leptonP4(),
+                                 *_synch_selector->goodMET(),
+                                 _synch_selector->goodJets());
+}
+
+void TemplateAnalyzer::fillReconstructions(const Mttbars &resonances)
+{
+    for(uint32_t reconstruction = 0, reconstructions = resonances.size();
+            reconstructions > reconstruction;
+            ++reconstruction)
+    {
+        const Mttbar &resonance = resonances[reconstruction];
+        if (!resonance.valid)
+            continue;
+
+        _reconstruction_mttbar[reconstruction]->fill(
+                mass(resonance.mttbar) / 1000, *_event_weight);
+
+        _reconstruction_ltop_mass[reconstruction]->fill(
+                mass(resonance.ltop), *_event_weight);
+
+        _reconstruction_htop_mass[reconstruction]->fill(
+                mass(resonance.htop), *_event_weight);
+
+        _reconstruction_htop_njets[reconstruction]->fill(
+                resonance.htop_jets.size(), *_event_weight);
+    }
+}
+
 void TemplateAnalyzer::monitorJets()
 {
     if (_synch_selector->goodJets().size())
-        jet1()->fill(*_synch_selector->goodJets()[0].corrected_p4,
+        jet1()->fill(_synch_selector->goodJets()[0].corrected_p4,
                      *_event_weight);
 
     if (1 < _synch_selector->goodJets().size())
-        jet2()->fill(*_synch_selector->goodJets()[1].corrected_p4,
+        jet2()->fill(_synch_selector->goodJets()[1].corrected_p4,
                      *_event_weight);
 
     if (2 < _synch_selector->goodJets().size())
-        jet3()->fill(*_synch_selector->goodJets()[2].corrected_p4,
+        jet3()->fill(_synch_selector->goodJets()[2].corrected_p4,
                      *_event_weight);
 }
 
 
-float TemplateAnalyzer::htlepValue() const
-{
-    // Note: leptons are kept in a vector of pointers
-    const LorentzVector &lepton_p4 =
-        SynchSelector::ELECTRON == _synch_selector->leptonMode()
-        ? (*_synch_selector->goodElectrons().begin())->physics_object().p4()
-        : (*_synch_selector->goodMuons().begin())->physics_object().p4();
+void TemplateAnalyzer::registerOutputs()
+{
+    _outputs.add("cutflow",
+            _synch_selector->cutflow(),
+            OutputRegistry::CUTFLOW_WEIGHTS,
+            "Cutflow");
+
+    _outputs.add("npv", _npv, "N_{PV}");
+    _outputs.add("npv_with_pileup", _npv_with_pileup, "N_{PV}^{with PU}");
+    _outputs.add("njets", _njets, "N_{jet}");
+    _outputs.add("d0", _d0, "i.p. [cm]");
+    _outputs.add("htlep", _htlep, "H_{T}^{lep} [GeV/c]");
+    _outputs.add("htall", _htall, "H_{T}^{all} [GeV/c]");
+
+    _outputs.add("htlep_after_htlep",
+            _htlep_after_htlep,
+            "H_{T}^{lep} [GeV/c]");
+
+    _outputs.add("htlep_before_htlep",
+            _htlep_before_htlep,
+            "H_{T}^{lep} [GeV/c]");
+
+    _outputs.add("htlep_before_htlep_qcd_noweight",
+            _htlep_before_htlep_noweight,
+            "H_{T}^{lep} [GeV/c]");
+
+    _outputs.add("solutions", _solutions, "N_{solutions}^{#nu}");
+
+    _outputs.add("mttbar_before_htlep",
+            _mttbar_before_htlep,
+            "M_{t#bar{t}} [TeV/c^{2}]");
+
+    _outputs.add("mttbar_after_htlep",
+            _mttbar_after_htlep,
+            "M_{t#bar{t}} [TeV/c^{2}]");
+
+    _outputs.add("normalization_mttbar",
+            _normalization_mttbar,
+            "M_{t#bar{t}} [TeV/c^{2}]");
+
+    _outputs.add("dr_vs_ptrel",
+            _dr_vs_ptrel,
+            "p_{T}^{rel}(jet,e) [GeV/c]",
+            "#Delta R");
+
+    _outputs.add("ttbar_pt", _ttbar_pt, "p_{T}^{t#bar{t}} [GeV/c]");
+    _outputs.add("wlep_mt", _wlep_mt, "M_{T}^{W,lep} [GeV/c^{2}]");
+    _outputs.add("whad_mt", _whad_mt, "M_{T}^{W,had} [GeV/c^{2}]");
+    _outputs.add("wlep_mass", _wlep_mass, "M^{W,lep} [GeV/c^{2}]");
+    _outputs.add("whad_mass", _whad_mass, "M^{W,had} [GeV/c^{2}]");
+    _outputs.add("met", _met, "MET [GeV/c]");
+    _outputs.add("met_noweight", _met_noweight, "MET [GeV/c]");
+
+    _outputs.add("ljet_met_dphi_vs_met_before_tricut",
+            _ljet_met_dphi_vs_met_before_tricut,
+            "MET [GeV/c]",
+            "#Delta #phi(jet1, MET)) [rad]");
+
+    _outputs.add("lepton_met_dphi_vs_met_before_tricut",
+            _lepton_met_dphi_vs_met_before_tricut,
+            "MET [GeV/c]",
+            "#Delta #phi(e, MET)) [rad]");
+
+    _outputs.add("ljet_met_dphi_vs_met",
+            _ljet_met_dphi_vs_met,
+            "MET [GeV/c]",
+            "#Delta #phi(jet1, MET)) [rad]");
+
+    _outputs.add("lepton_met_dphi_vs_met",
+            _lepton_met_dphi_vs_met,
+            "MET [GeV/c]",
+            "#Delta #phi(e, MET)) [rad]");
+
+    _outputs.add("htop_njets", _htop_njets, "N_{jets}^{htop}");
+
+    _outputs.add("htop_delta_r",
+            _htop_delta_r,
+            "#Delta R(jet1^{htop}, jet2^{htop})");
+
+    _outputs.add("htop_njet_vs_m",
+            _htop_njet_vs_m,
+            "M^{htop} [GeV/c^{2}]",
+            "N^{htop jet}");
+
+    _outputs.add("htop_pt_vs_m",
+            _htop_pt_vs_m,
+            "M^{htop} [GeV/c^{2}]",
+            "p_{T}^{htop} [GeV/c]");
+
+    _outputs.add("htop_pt_vs_njets",
+            _htop_pt_vs_njets,
+            "N_jets",
+            "p_{T}^{htop} [GeV/c]");
+
+    _outputs.add("htop_pt_vs_ltop_pt",
+            _htop_pt_vs_ltop_pt,
+            "p_{T}^{ltop} [GeV/c]",
+            "p_{T}^{htop} [GeV/c]");
+
+    _outputs.add("ltop_drsum", _ltop_drsum);
+    _outputs.add("htop_drsum", _htop_drsum);
+    _outputs.add("htop_dphi", _htop_dphi);
+    _outputs.add("chi2", _chi2);
+    _outputs.add("ltop_chi2", _ltop_chi2);
+    _outputs.add("htop_chi2", _htop_chi2);
+    _outputs.add("btag", _btag);
+
+    _outputs.add("njets_before_reconstruction",
+            _njets_before_reconstruction,
+            "N_{jet}^{before reconstruction}");
+
+    _outputs.add("njet2_dr_lepton_jet1_before_reconstruction",
+            _njet2_dr_lepton_jet1_before_reconstruction,
+            "#Delta R(lepton, jet1)_{N_{jets} = 2}");
+
+    _outputs.add("njet2_dr_lepton_jet2_before_reconstruction",
+            _njet2_dr_lepton_jet2_before_reconstruction,
+            "#Delta R(lepton, jet2)_{N_{jets} = 2}");
+
+    _outputs.add("njets_after_reconstruction",
+            _njets_after_reconstruction,
+            "N_{jet}^{after reconstruction}");
+
+    _outputs.add("njet2_dr_lepton_jet1_after_reconstruction",
+            _njet2_dr_lepton_jet1_after_reconstruction,
+            "#Delta R(lepton, jet1)_{N_{jets} = 2}");
+
+    _outputs.add("njet2_dr_lepton_jet2_after_reconstruction",
+            _njet2_dr_lepton_jet2_after_reconstruction,
+            "#Delta R(lepton, jet2)_{N_{jets} = 2}");
+
+    _outputs.add("jet1", _jet1, "jet1");
+    _outputs.add("jet2", _jet2, "jet2");
+    _outputs.add("jet3", _jet3, "jet3");
+    _outputs.add("Electron", _electron, "e");
+    _outputs.add("Electron Before Tricut",
+            _electron_before_tricut,
+            "e_no_tricut");
+
+    _outputs.add("ltop", _ltop, "ltop");
+    _outputs.add("htop", _htop, "htop");
+    _outputs.add("htop_1jets", _htop_1jets, "htop_1jets");
+    _outputs.add("htop_2jets", _htop_2jets, "htop_2jets");
+
+    _outputs.add("htop jet1", _htop_jet1, "htop_jet1");
+    _outputs.add("htop jet2", _htop_jet2, "htop_jet2");
+    _outputs.add("htop jet3", _htop_jet3, "htop_jet3");
+    _outputs.add("htop jet4", _htop_jet4, "htop_jet4");
+
+    _outputs.add("ltop jet1", _ltop_jet1, "ltop_jet1");
+
+    if (_compare_reconstructions)
+    {
+        for(uint32_t reconstruction = 0;
+                reconstructions() > reconstruction;
+                ++reconstruction)
+        {
+            registerReconstructionOutputs(reconstruction);
+        }
+    }
+
+    if (_bootstrap.isEnabled())
+        registerBootstrapOutputs();
 
-    return pt(*_synch_selector->goodMET()) + pt(lepton_p4);
+    if (_synch_selector->categories())
+        registerCategoryOutputs();
 }
 
-float TemplateAnalyzer::htallValue() const
+void TemplateAnalyzer::registerBootstrapOutputs()
 {
-    // Computting the HT of the event
-    float htjets = 0;
-    for(
-        SynchSelector::GoodJets::const_iterator jet =
-        _synch_selector->goodJets().begin();
-        _synch_selector->goodJets().end() != jet;
-        ++jet
-    )
-        htjets += pt(*jet->corrected_p4);
+    _outputs.add("mttbar_before_htlep_bootstrap",
+            _bootstrap_mttbar_before_htlep,
+            "M_{t#bar{t}} [TeV/c^{2}]",
+            "bootstrap");
 
-    return htjets + htlepValue();
+    _outputs.add("mttbar_after_htlep_bootstrap",
+            _bootstrap_mttbar_after_htlep,
+            "M_{t#bar{t}} [TeV/c^{2}]",
+            "bootstrap");
+
+    _outputs.add("htlep_before_htlep_bootstrap",
+            _bootstrap_htlep_before_htlep,
+            "H_{T}^{lep} [GeV/c]",
+            "bootstrap");
+
+    _outputs.add("htlep_after_htlep_bootstrap",
+            _bootstrap_htlep_after_htlep,
+            "H_{T}^{lep} [GeV/c]",
+            "bootstrap");
 }
 
-WDecay TemplateAnalyzer::eventDecay(const Event *event) const
+// Each lepton channel and W flavor category histograms and cutflow are
+// named with the category suffix, e.g. njets_muon_wbx, cutflow_muon_wbx
+//
+void TemplateAnalyzer::registerCategoryOutputs()
 {
-    WDecay decay;
-
-    const GenParticles &particles = event->gen_particle();
-    for(GenParticles::const_iterator particle = particles.begin();
-            particles.end() != particle
-                && WDecay::UNKNOWN == decay.type();
-            ++particle)
+    for(uint32_t category = 0; SynchSelector::CATEGORIES > category; ++category)
     {
-        if (3 != particle->status())
-            continue;
+        const string suffix = "_" + SynchSelector::categoryName(category);
 
-        /*
-        decay = decayType(*particle);
+        _outputs.add("cutflow" + suffix,
+                _synch_selector->cutflow(category),
+                OutputRegistry::CUTFLOW_WEIGHTS,
+                "Cutflow");
 
-        continue;
-        */
+        _outputs.add("njets" + suffix,
+                _category_njets.at(category),
+                "N_{jet}");
 
-        // Skip everything but W-boson
-        //
-        if (24 != abs(particle->id()))
-            continue;
+        _outputs.add("met" + suffix,
+                _category_met.at(category),
+                "MET [GeV/c]");
+
+        _outputs.add("htlep_after_htlep" + suffix,
+                _category_htlep_after_htlep.at(category),
+                "H_{T}^{lep} [GeV/c]");
+
+        _outputs.add("mttbar_after_htlep" + suffix,
+                _category_mttbar_after_htlep.at(category),
+                "M_{t#bar{t}} [TeV/c^{2}]");
 
-        decay = wdecayType(*particle);
+        _outputs.add("htlep_before_htlep" + suffix,
+                _category_htlep_before_htlep.at(category),
+                "H_{T}^{lep} [GeV/c]");
+
+        _outputs.add("htlep_before_htlep_qcd_noweight" + suffix,
+                _category_htlep_before_htlep_noweight.at(category),
+                "H_{T}^{lep} [GeV/c]");
+
+        _outputs.add("mttbar_before_htlep" + suffix,
+                _category_mttbar_before_htlep.at(category),
+                "M_{t#bar{t}} [TeV/c^{2}]");
     }
+}
+
+// Compared reconstructions histograms are named with the reconstruction
+// suffix, e.g. reco_mttbar_chi2
+//
+void TemplateAnalyzer::registerReconstructionOutputs(
+        const uint32_t &reconstruction)
+{
+    const string suffix = "_" + reconstructionName(reconstruction);
+
+    _outputs.add("reco_mttbar" + suffix,
+            _reconstruction_mttbar.at(reconstruction),
+            "M_{t#bar{t}} [TeV/c^{2}]");
 
-    return decay;
+    _outputs.add("reco_ltop_mass" + suffix,
+            _reconstruction_ltop_mass.at(reconstruction),
+            "M_{t}^{lep} [GeV/c^{2}]");
+
+    _outputs.add("reco_htop_mass" + suffix,
+            _reconstruction_htop_mass.at(reconstruction),
+            "M_{t}^{had} [GeV/c^{2}]");
+
+    _outputs.add("reco_htop_njets" + suffix,
+            _reconstruction_htop_njets.at(reconstruction),
+            "N_{jets}^{htop}");
 }
 
-WDecay TemplateAnalyzer::decayType(const GenParticle &particle) const
+void TemplateAnalyzer::bookCategories(CategoryH1Proxies &histograms,
+                                      const uint32_t &bins,
+                                      const float &min,
+                                      const float &max)
 {
-    WDecay decay;
+    for(uint32_t category = 0; SynchSelector::CATEGORIES > category; ++category)
+    {
+        histograms.push_back(H1ProxyPtr(new H1Proxy(bins, min, max,
+                                                    ALLOCATE_ON_FILL)));
+        monitor(histograms.back());
+    }
+}
 
-    const GenParticles &particles = particle.child();
-    for(GenParticles::const_iterator child = particles.begin();
-            particles.end() != child
-                && WDecay::UNKNOWN == decay.type();
-            ++child)
+void TemplateAnalyzer::cloneHistograms(CategoryH1Proxies &histograms,
+                                       const CategoryH1Proxies &original)
+{
+    for(CategoryH1Proxies::const_iterator histogram = original.begin();
+            original.end() != histogram;
+            ++histogram)
     {
-        // Skip all unstable parents
-        //
-        if (3 != child->status())
-            continue;
+        histograms.push_back(
+                dynamic_pointer_cast<H1Proxy>((*histogram)->clone()));
+        monitor(histograms.back());
+    }
+}
 
-        // Skip everything but W-boson
-        //
-        if (24 != abs(child->id()))
-            continue;
+void TemplateAnalyzer::setReconstructor(ResonanceReconstructor *reconstructor,
+                                        const string &name)
+{
+    stopMonitor(_reconstructor);
 
-        decay = wdecayType(*child);
-    } // End loop over parents
+    _reconstructor.reset(reconstructor);
+    _reconstructor->setMaxJets(_reconstruction_max_jets);
 
-    return decay;
+    monitor(_reconstructor);
+
+    addReconstruction(name);
 }
 
-WDecay TemplateAnalyzer::wdecayType(const GenParticle &particle) const
+void TemplateAnalyzer::addReconstruction(const string &name)
 {
-    WDecay decay;
+    // Comparison keeps its own copy of the reconstructor
+    //
+    _reconstructions->add(dynamic_pointer_cast<ResonanceReconstructor>(
+                _reconstructor->clone()));
+
+    _reconstruction_names.push_back(name);
+
+    _reconstruction_mttbar.push_back(H1ProxyPtr(new H1Proxy(4000, 0, 4,
+                    ALLOCATE_ON_FILL)));
+    monitor(_reconstruction_mttbar.back());
+
+    _reconstruction_ltop_mass.push_back(H1ProxyPtr(new H1Proxy(500, 0, 500,
+                    ALLOCATE_ON_FILL)));
+    monitor(_reconstruction_ltop_mass.back());
+
+    _reconstruction_htop_mass.push_back(H1ProxyPtr(new H1Proxy(500, 0, 500,
+                    ALLOCATE_ON_FILL)));
+    monitor(_reconstruction_htop_mass.back());
+
+    _reconstruction_htop_njets.push_back(H1ProxyPtr(new H1Proxy(10, 0, 10,
+                    ALLOCATE_ON_FILL)));
+    monitor(_reconstruction_htop_njets.back());
 
-    const GenParticles &children = particle.child();
-    for(GenParticles::const_iterator child = children.begin();
-            children.end() != child
-                && WDecay::UNKNOWN == decay.type();
-            ++child)
+    if (_compare_reconstructions)
+        registerReconstructionOutputs(reconstructions() - 1);
+}
+
+const bsm::LorentzVector &TemplateAnalyzer::leptonP4() const
+{
+    // Note: leptons are kept in a vector of pointers
+    //
+    return SynchSelector::ELECTRON == _synch_selector->leptonMode()
+        ? (*_synch_selector->goodElectrons().begin())->physics_object().p4()
+        : (*_synch_selector->goodMuons().begin())->physics_object().p4();
+}
+
+float TemplateAnalyzer::htlepValue() const
+{
+    return pt(*_synch_selector->goodMET()) + pt(leptonP4());
+}
+
+float TemplateAnalyzer::htallValue() const
+{
+    // Computting the HT of the event
+    float htjets = 0;
+    for(
+        SynchSelector::GoodJets::const_iterator jet =
+        _synch_selector->goodJets().begin();
+        _synch_selector->goodJets().end() != jet;
+        ++jet
+    )
+        htjets += jet->corrected_pt;
+
+    return htjets + htlepValue();
+}
+
+WDecay TemplateAnalyzer::eventDecay(const Event *event)
+{
+    _gen_decay.fill(event);
+
+    // The first status 3 W-boson with leptonic decay defines the event decay
+    //
+    const GenDecay::Indices &particles = _gen_decay.hardParticles();
+    for(GenDecay::Indices::const_iterator particle = particles.begin();
+            particles.end() != particle;
+            ++particle)
     {
-        // Skip unstable particles
+        // Skip everything but W-boson
         //
-        if (3 != child->status())
+        if (24 != abs(_gen_decay.id(*particle)))
             continue;
 
-        switch(abs(child->id()))
+        switch(_gen_decay.decay(*particle))
         {
-            case 11: // Electron
-                decay.setType(WDecay::ELECTRON);
-                break;
+            case GenDecay::ELECTRON:
+                return WDecay(WDecay::ELECTRON);
 
-            case 13: // Muon
-                decay.setType(WDecay::MUON);
-                break;
+            case GenDecay::MUON:
+                return WDecay(WDecay::MUON);
+
+            case GenDecay::TAU:
+                return WDecay(WDecay::TAU);
 
-            case 15: // Tau
-                decay.setType(WDecay::TAU);
+            default:
                 break;
         }
-    } // end loop over children
+    }
 
-    return decay;
+    return WDecay();
 }
 
 void TemplateAnalyzer::invalidate_cache()
@@ -1892,7 +2695,7 @@ void TemplateAnalyzer::fill_btag()
         {
             if (Jet::BTag::CSV == jet_btag->type())
             {
-                btag()->fill(jet_btag->discriminator());
+                _btag->fill(jet_btag->discriminator());
 
                 break;
             }
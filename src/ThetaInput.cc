@@ -0,0 +1,160 @@
+// Theta Input
+//
+// Write templates in the theta convention directly from the analyzer:
+//
+//      [channel]_[plot]__[process][__[systematic]__plus|minus]
+//
+// Templates are rebinned to the final binning and normalized with the
+// sample scale. The file is updated: jobs of different samples and
+// systematics may be run one after another into the same theta input
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <iostream>
+#include <stdexcept>
+
+#include <boost/shared_ptr.hpp>
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+
+#include "bsm_stat/interface/H1.h"
+#include "bsm_stat/interface/Utility.h"
+#include "interface/StatProxy.h"
+#include "interface/ThetaInput.h"
+
+using namespace std;
+
+using bsm::ThetaInput;
+
+ThetaInput::Template::Template(const string &plot,
+        const H1ProxyPtr &histogram,
+        const uint32_t &rebin):
+    plot(plot),
+    histogram(histogram),
+    rebin(rebin)
+{
+}
+
+ThetaInput::ThetaInput():
+    _channel("el"),
+    _scale(1)
+{
+}
+
+void ThetaInput::setFile(const string &file_name)
+{
+    _file_name = file_name;
+}
+
+void ThetaInput::setChannel(const string &channel)
+{
+    _channel = channel;
+}
+
+void ThetaInput::setProcess(const string &process)
+{
+    // QCD template is estimated from data sidebands and normalized with
+    // the fraction fit: neither is done here
+    //
+    if ("eleqcd" == process)
+        throw runtime_error("theta QCD template can not be written by "
+                            "analyzer");
+
+    _process = process;
+}
+
+void ThetaInput::setSystematic(const string &systematic)
+{
+    if (systematic.empty())
+    {
+        _systematic.clear();
+
+        return;
+    }
+
+    const char direction = *systematic.rbegin();
+    if (2 > systematic.size()
+            || ('+' != direction
+                && '-' != direction))
+        throw runtime_error("theta systematic should end with + or -: "
+                            + systematic);
+
+    _systematic = "__" + systematic.substr(0, systematic.size() - 1)
+        + ('+' == direction ? "__plus" : "__minus");
+}
+
+void ThetaInput::setScale(const float &scale)
+{
+    _scale = scale;
+}
+
+bool ThetaInput::isEnabled() const
+{
+    return !_file_name.empty()
+        && !_process.empty();
+}
+
+string ThetaInput::name(const string &plot) const
+{
+    return _channel + "_" + plot + "__" + _process + _systematic;
+}
+
+bool ThetaInput::save(const Templates &templates) const
+{
+    if (!isEnabled())
+        return false;
+
+    TDirectory *pwd = gDirectory;
+
+    boost::shared_ptr<TFile> output(new TFile(_file_name.c_str(), "UPDATE"));
+    if (!output->IsOpen())
+    {
+        cerr << "failed to open theta input: " << _file_name << endl;
+
+        if (pwd)
+            pwd->cd();
+
+        return false;
+    }
+
+    for(Templates::const_iterator output_template = templates.begin();
+            templates.end() != output_template;
+            ++output_template)
+    {
+        if (!output_template->histogram)
+            continue;
+
+        stat::TH1Ptr histogram =
+            convert(*output_template->histogram->histogram());
+
+        const string template_name = name(output_template->plot);
+        histogram->SetName(template_name.c_str());
+        histogram->SetDirectory(0);
+
+        if (1 < output_template->rebin)
+            histogram->Rebin(output_template->rebin);
+
+        if (1 != _scale)
+        {
+            if (!histogram->GetSumw2N())
+                histogram->Sumw2();
+
+            histogram->Scale(_scale);
+        }
+
+        // Previous cycles of the template are replaced
+        //
+        output->WriteTObject(histogram.get(), template_name.c_str(),
+                             "Overwrite");
+    }
+
+    output->Close();
+
+    if (pwd)
+        pwd->cd();
+
+    return true;
+}
@@ -16,6 +16,7 @@
 #include "bsm_core/interface/Keyboard.h"
 
 #include "interface/Analyzer.h"
+#include "interface/OutputRegistry.h"
 #include "interface/Thread.h"
 #include "interface/Utility.h"
 
@@ -141,6 +142,16 @@ AnalyzerPtr AnalyzerOperation::analyzer() const
     return _analyzer;
 }
 
+AnalyzerPtr AnalyzerOperation::snapshot() const
+{
+    if (!thread())
+        return AnalyzerPtr();
+
+    Lock lock(thread()->condition());
+
+    return boost::dynamic_pointer_cast<Analyzer>(_analyzer->clone());
+}
+
 bool AnalyzerOperation::init(const std::string &file_name)
 {
     if (file_name.empty())
@@ -353,7 +364,8 @@ void AnalyzerOperation::waitForInstructions()
 ThreadController::ThreadController(const uint32_t &max_threads):
     _max_threads(min(max_threads ? max_threads : INT_MAX,
                 boost::thread::hardware_concurrency())),
-    _analyzer_is_reader_delegate(false)
+    _analyzer_is_reader_delegate(false),
+    _snapshot_interval(0)
 {
     _condition.reset(new core::Condition());
     _input_files.reset(new InputFiles());
@@ -384,6 +396,13 @@ bool ThreadController::isAnalyzerReaderDelegate() const
     return _analyzer_is_reader_delegate;
 }
 
+void ThreadController::setSnapshot(const uint32_t &interval,
+        const std::string &file_name)
+{
+    _snapshot_interval = file_name.empty() ? 0 : interval;
+    _snapshot_file_name = file_name;
+}
+
 void ThreadController::push(const std::string &file_name)
 {
     Lock lock(condition());
@@ -399,6 +418,9 @@ void ThreadController::start()
 
     _summary.reset(new Summary(_input_files->size()));
 
+    _next_snapshot = boost::get_system_time()
+        + boost::posix_time::seconds(_snapshot_interval);
+
     //startKeyboardThread();
 
     for(uint32_t threads_to_create = countMaxThreads();
@@ -521,24 +543,30 @@ void ThreadController::run()
 {
     for(; isRunning();)
     {
-        // Wait for any thread to finish
+        // Wait for any thread to finish and process waiting threads
         //
-        wait();
+        if (wait())
+            onThreadWait();
 
-        // Process waiting threads
-        //
-        onThreadWait();
+        if (isSnapshotTime())
+            snapshot();
     }
 }
 
-void ThreadController::wait()
+bool ThreadController::wait()
 {
     Lock lock(condition());
 
     while(_threads_waiting->empty())
     {
-        condition()->variable()->wait(lock());
+        if (!_snapshot_interval)
+            condition()->variable()->wait(lock());
+        else if (!condition()->variable()->timed_wait(lock(), _next_snapshot)
+                && _threads_waiting->empty())
+            return false;
     }
+
+    return true;
 }
 
 bool ThreadController::isRunning() const
@@ -548,6 +576,46 @@ bool ThreadController::isRunning() const
     return !_threads.empty();
 }
 
+bool ThreadController::isSnapshotTime() const
+{
+    Lock lock(condition());
+
+    return _snapshot_interval
+        && !_threads.empty()
+        && boost::get_system_time() >= _next_snapshot;
+}
+
+void ThreadController::snapshot()
+{
+    using boost::dynamic_pointer_cast;
+
+    // Threads are merged into the analyzer and removed from the list by
+    // this thread only: every event is counted once
+    //
+    AnalyzerPtr snapshot = dynamic_pointer_cast<Analyzer>(_analyzer->clone());
+
+    for(Threads::const_iterator thread = _threads.begin();
+            _threads.end() != thread;
+            ++thread)
+    {
+        AnalyzerOperationPtr operation =
+            dynamic_pointer_cast<AnalyzerOperation>(thread->first->operation());
+
+        if (!operation)
+            continue;
+
+        AnalyzerPtr copy = operation->snapshot();
+        if (copy)
+            snapshot->merge(copy);
+    }
+
+    if (snapshot->outputs())
+        snapshot->outputs()->save(_snapshot_file_name);
+
+    _next_snapshot = boost::get_system_time()
+        + boost::posix_time::seconds(_snapshot_interval);
+}
+
 void ThreadController::onThreadWait()
 {
     using boost::dynamic_pointer_cast;
@@ -25,6 +25,23 @@ using namespace boost;
 using bsm::TriggerAnalyzer;
 using bsm::TriggerOptions;
 
+namespace
+{
+    // Triggers are identified by the hash of lower case name
+    //
+    bsm::Trigger makeTrigger(string name)
+    {
+        hash<std::string> make_hash;
+
+        to_lower(name);
+
+        bsm::Trigger trigger;
+        trigger.set_hash(make_hash(name));
+
+        return trigger;
+    }
+}
+
 // Trigger options
 //
 TriggerOptions::TriggerOptions()
@@ -38,6 +55,16 @@ TriggerOptions::TriggerOptions()
              boost::bind(&TriggerOptions::setTrigger, this, _1)),
          "Use trigger")
 
+        ("electron-trigger",
+         po::value<Triggers>()->notifier(
+             boost::bind(&TriggerOptions::setElectronTrigger, this, _1)),
+         "Use trigger for electron channel events only")
+
+        ("muon-trigger",
+         po::value<Triggers>()->notifier(
+             boost::bind(&TriggerOptions::setMuonTrigger, this, _1)),
+         "Use trigger for muon channel events only")
+
         ("trigger-filter",
          po::value<string>()->notifier(
              boost::bind(&TriggerOptions::setFilter, this, _1)),
@@ -80,14 +107,33 @@ void TriggerOptions::setTrigger(const Triggers &trigger_names) const
             trigger_names.end() != name;
             ++name)
     {
-        hash<std::string> make_hash;
+        delegate()->setTrigger(makeTrigger(*name));
+    }
+}
 
-        string trigger_name = *name;
-        to_lower(trigger_name);
-        Trigger trigger;
-        trigger.set_hash(make_hash(trigger_name));
+void TriggerOptions::setElectronTrigger(const Triggers &trigger_names) const
+{
+    if (!delegate())
+        return;
+
+    for(Triggers::const_iterator name = trigger_names.begin();
+            trigger_names.end() != name;
+            ++name)
+    {
+        delegate()->setElectronTrigger(makeTrigger(*name));
+    }
+}
 
-        delegate()->setTrigger(trigger);
+void TriggerOptions::setMuonTrigger(const Triggers &trigger_names) const
+{
+    if (!delegate())
+        return;
+
+    for(Triggers::const_iterator name = trigger_names.begin();
+            trigger_names.end() != name;
+            ++name)
+    {
+        delegate()->setMuonTrigger(makeTrigger(*name));
     }
 }
 
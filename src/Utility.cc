@@ -106,7 +106,7 @@ bool PtGreater::operator()(const LorentzVector *v1, const LorentzVector *v2)
 //
 bool CorrectedPtLess::operator()(const CorrectedJet &v1, const CorrectedJet &v2)
 {
-    return _pt_less(v1.corrected_p4, v2.corrected_p4);
+    return v1.corrected_pt < v2.corrected_pt;
 }
 
 
@@ -115,5 +115,5 @@ bool CorrectedPtLess::operator()(const CorrectedJet &v1, const CorrectedJet &v2)
 //
 bool CorrectedPtGreater::operator()(const CorrectedJet &v1, const CorrectedJet &v2)
 {
-    return _pt_greater(v1.corrected_p4, v2.corrected_p4);
+    return v1.corrected_pt > v2.corrected_pt;
 }
@@ -8,13 +8,6 @@
 
 #include <boost/shared_ptr.hpp>
 
-#include <TFile.h>
-#include <TGaxis.h>
-#include <TH1.h>
-#include <TH2.h>
-#include <TRint.h>
-
-#include "bsm_stat/interface/Utility.h"
 #include "interface/AppController.h"
 #include "interface/Btag.h"
 #include "interface/JetEnergyCorrections.h"
@@ -54,28 +47,9 @@ int main(int argc, char *argv[])
 
         app->setAnalyzer(analyzer);
 
+        // Registered histograms are written by AppController
+        //
         result = app->run(argc, argv);
-        if (result && app->output())
-        {
-            typedef bsm::stat::TH1Ptr TH1Ptr;
-            typedef bsm::stat::TH2Ptr TH2Ptr;
-
-            int empty_argc = 1;
-            char *empty_argv[] = { argv[0] };
-
-            boost::shared_ptr<TRint>
-                root(new TRint("app", &empty_argc, empty_argv));
-
-            TGaxis::SetMaxDigits(3);
-
-            TH1Ptr parton_jets = convert(*analyzer->parton_jets());
-            parton_jets->SetName("parton_jets");
-            parton_jets->Write();
-
-            TH1Ptr btagged_parton_jets = convert(*analyzer->btagged_parton_jets());
-            btagged_parton_jets->SetName("btagged_parton_jets");
-            btagged_parton_jets->Write();
-        }
     }
     catch(const std::exception &error)
     {
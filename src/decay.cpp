@@ -8,17 +8,8 @@
 
 #include <boost/shared_ptr.hpp>
 
-#include <TCanvas.h>
-#include <TFile.h>
-#include <TGaxis.h>
-#include <TH1.h>
-#include <TH2.h>
-#include <TRint.h>
-
-#include "bsm_stat/interface/Utility.h"
 #include "interface/AppController.h"
 #include "interface/DecayAnalyzer.h"
-#include "interface/MonitorCanvas.h"
 
 using namespace std;
 using namespace boost;
@@ -36,52 +27,9 @@ int main(int argc, char *argv[])
 
         app->setAnalyzer(analyzer);
 
+        // Registered histograms are written by AppController
+        //
         result = app->run(argc, argv);
-        if (result)
-        {
-            typedef bsm::stat::TH1Ptr TH1Ptr;
-            typedef bsm::stat::TH2Ptr TH2Ptr;
-
-            int empty_argc = 1;
-            char *empty_argv[] = { argv[0] };
-
-            boost::shared_ptr<TRint>
-                root(new TRint("app", &empty_argc, empty_argv));
-
-            TH2Ptr decay_level_1 = convert(*analyzer->decay_level_1());
-            decay_level_1->SetName("decay_level_1");
-            decay_level_1->GetXaxis()->SetTitle("Particle");
-            decay_level_1->GetYaxis()->SetTitle("Parent");
-
-            TH2Ptr decay_level_2 = convert(*analyzer->decay_level_2());
-            decay_level_2->SetName("decay_level_2");
-            decay_level_2->GetXaxis()->SetTitle("Particle");
-            decay_level_2->GetYaxis()->SetTitle("Parent");
-
-            TH2Ptr decay_level_3 = convert(*analyzer->decay_level_3());
-            decay_level_3->SetName("decay_level_3");
-            decay_level_3->GetXaxis()->SetTitle("Particle");
-            decay_level_3->GetYaxis()->SetTitle("Parent");
-
-            TH2Ptr decay_level_4 = convert(*analyzer->decay_level_4());
-            decay_level_4->SetName("decay_level_4");
-            decay_level_4->GetXaxis()->SetTitle("Particle");
-            decay_level_4->GetYaxis()->SetTitle("Parent");
-
-            TH2Ptr decay_level_5 = convert(*analyzer->decay_level_5());
-            decay_level_5->SetName("decay_level_5");
-            decay_level_5->GetXaxis()->SetTitle("Particle");
-            decay_level_5->GetYaxis()->SetTitle("Parent");
-
-            if (app->output())
-            {
-                decay_level_1->Write();
-                decay_level_2->Write();
-                decay_level_3->Write();
-                decay_level_4->Write();
-                decay_level_5->Write();
-            }
-        }
     }
     catch(const std::exception &error)
     {
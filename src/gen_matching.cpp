@@ -9,19 +9,10 @@
 
 #include <boost/shared_ptr.hpp>
 
-#include <TCanvas.h>
-#include <TFile.h>
-#include <TGaxis.h>
-#include <TH1.h>
-#include <TH2.h>
-#include <TRint.h>
-
-#include "bsm_stat/interface/Utility.h"
 #include "interface/AppController.h"
 #include "interface/Btag.h"
 #include "interface/Cut2DSelector.h"
 #include "interface/JetEnergyCorrections.h"
-#include "interface/MonitorCanvas.h"
 #include "interface/Pileup.h"
 #include "interface/GenMatchingAnalyzer.h"
 #include "interface/TemplateAnalyzer.h"
@@ -62,58 +53,10 @@ int main(int argc, char *argv[])
 
         app->setAnalyzer(analyzer);
 
+        // Registered histograms, cutflow and monitors are written by
+        // AppController
+        //
         result = app->run(argc, argv);
-        if (result)
-        {
-            typedef bsm::stat::TH1Ptr TH1Ptr;
-            typedef bsm::stat::TH2Ptr TH2Ptr;
-
-            int empty_argc = 1;
-            char *empty_argv[] = { argv[0] };
-
-            boost::shared_ptr<TRint>
-                root(new TRint("app", &empty_argc, empty_argv));
-
-            TGaxis::SetMaxDigits(3);
-
-            TH1Ptr cutflow = convert(*analyzer->cutflow());
-            cutflow->SetName("cutflow");
-
-            TH1Ptr ltop_drsum = convert(*analyzer->ltop_drsum());
-            ltop_drsum->SetName("ltop_drsum");
-
-            TH1Ptr htop_drsum = convert(*analyzer->htop_drsum());
-            htop_drsum->SetName("htop_drsum");
-
-            TH1Ptr htop_dphi = convert(*analyzer->htop_dphi());
-            htop_dphi->SetName("htop_dphi");
-
-            shared_ptr<P4Canvas> ltop(new P4Canvas("ltop", "ltop"));
-            shared_ptr<P4Canvas> htop(new P4Canvas("htop", "htop"));
-            shared_ptr<P4Canvas> htop_1jet(new P4Canvas("htop_1jet", "htop_1jet"));
-            shared_ptr<P4Canvas> htop_2jet(new P4Canvas("htop_2jet", "htop_2jet"));
-            shared_ptr<P4Canvas> htop_3jet(new P4Canvas("htop_3jet", "htop_3jet"));
-
-            shared_ptr<P4Canvas> ttbar(new P4Canvas("ttbar", "ttbar"));
-
-            if (app->output())
-            {
-                cutflow->Write();
-
-                ltop_drsum->Write();
-                htop_drsum->Write();
-                htop_dphi->Write();
-
-                ltop->write(*analyzer->ltop(), app->output().get());
-                htop->write(*analyzer->htop(), app->output().get());
-
-                htop_1jet->write(*analyzer->htop_1jet(), app->output().get());
-                htop_2jet->write(*analyzer->htop_2jet(), app->output().get());
-                htop_3jet->write(*analyzer->htop_3jet(), app->output().get());
-
-                ttbar->write(*analyzer->ttbar(), app->output().get());
-            }
-        }
     }
     catch(const std::exception &error)
     {
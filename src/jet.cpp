@@ -10,14 +10,10 @@
 
 #include <TCanvas.h>
 #include <TGaxis.h>
-#include <TH1.h>
-#include <TH2.h>
 #include <TRint.h>
-#include <TFile.h>
 
 #include "bsm_input/interface/Event.pb.h"
 #include "bsm_stat/interface/bsm_stat_fwd.h"
-#include "bsm_stat/interface/Utility.h"
 #include "interface/AppController.h"
 #include "interface/JetEnergyCorrections.h"
 #include "interface/MonitorCanvas.h"
@@ -57,8 +53,11 @@ int main(int argc, char *argv[])
 
         app->setAnalyzer(analyzer);
 
+        // Registered monitors are written by AppController
+        //
         result = app->run(argc, argv);
-        if (result)
+        if (result
+                && app->isInteractive())
         {
             int empty_argc = 1;
             char *empty_argv[] = { argv[0] };
@@ -70,38 +69,18 @@ int main(int argc, char *argv[])
 
             shared_ptr<P4Canvas> reco_leading_jet_canvas(
                     new P4Canvas("Reco Leading Jet"));
+            reco_leading_jet_canvas->draw(*analyzer->recoLeadingJetMonitor());
 
             shared_ptr<P4Canvas> hlt_leading_jet_canvas(
                     new P4Canvas("HLT Leading Jet"));
+            hlt_leading_jet_canvas->draw(*analyzer->hltLeadingJetMonitor());
 
             shared_ptr<P4Canvas> selected_hlt_leading_jet_canvas(
                     new P4Canvas("Selected HLT Leading Jet"));
+            selected_hlt_leading_jet_canvas->draw(
+                    *analyzer->selectedHltLeadingJetMonitor());
 
-            if (app->output())
-            {
-                reco_leading_jet_canvas->write(*analyzer->recoLeadingJetMonitor(),
-                        app->output().get());
-
-                hlt_leading_jet_canvas->write(*analyzer->hltLeadingJetMonitor(),
-                        app->output().get());
-
-                selected_hlt_leading_jet_canvas->write(*analyzer->selectedHltLeadingJetMonitor(),
-                        app->output().get());
-            }
-            
-            if (app->isInteractive())
-            {
-                reco_leading_jet_canvas->draw(
-                        *analyzer->recoLeadingJetMonitor());
-
-                hlt_leading_jet_canvas->draw(
-                        *analyzer->hltLeadingJetMonitor());
-
-                selected_hlt_leading_jet_canvas->draw(
-                        *analyzer->selectedHltLeadingJetMonitor());
-
-                root->Run();
-            }
+            root->Run();
         }
     }
     catch(const exception &error)
@@ -0,0 +1,281 @@
+// Merge histograms of many job outputs into one file
+//
+// Inputs are read one by one and every histogram is added to the running
+// sum with the same path in the output. Each input may carry a scale:
+//
+//      output.root            scale 1
+//      output.root:0.5        explicit scale
+//      output.root:wjets      scale of the sample from the theta scale file,
+//                             --scale-file is required
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/program_options.hpp>
+#include <boost/regex.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TKey.h>
+#include <TList.h>
+
+#include "interface/ThetaScale.h"
+
+using namespace std;
+using namespace boost;
+namespace po = program_options;
+
+typedef shared_ptr<TH1> TH1Ptr;
+
+// Histograms are kept in the order of the first appearance
+//
+struct Products
+{
+    typedef map<string, TH1Ptr> Histograms;
+    typedef vector<string> Paths;
+
+    Histograms histograms;
+    Paths paths;
+};
+
+float sampleScale(const ThetaScale &theta_scale, const string &sample)
+{
+    if ("wjets" == sample)
+        return theta_scale.wjets;
+
+    if ("zjets" == sample)
+        return theta_scale.zjets;
+
+    if ("singletop" == sample)
+        return theta_scale.stop;
+
+    if ("ttbar" == sample)
+        return theta_scale.ttjets;
+
+    if ("eleqcd" == sample)
+        return theta_scale.qcd;
+
+    throw runtime_error("unknown sample: " + sample);
+}
+
+void merge(Products &products,
+        TDirectory *directory,
+        const string &path,
+        const float &scale)
+{
+    // Keys are listed with the highest cycle first: older cycles of the
+    // same object are skipped
+    //
+    set<string> cycles;
+
+    TIter next(directory->GetListOfKeys());
+    for(TKey *key = 0; (key = dynamic_cast<TKey *>(next())); )
+    {
+        if (!cycles.insert(key->GetName()).second)
+            continue;
+
+        const string name = path.empty()
+            ? string(key->GetName())
+            : path + "/" + key->GetName();
+
+        TObject *object = key->ReadObj();
+
+        if (TDirectory *folder = dynamic_cast<TDirectory *>(object))
+        {
+            merge(products, folder, name, scale);
+
+            continue;
+        }
+
+        TH1 *histogram = dynamic_cast<TH1 *>(object);
+        if (!histogram)
+        {
+            delete object;
+
+            continue;
+        }
+
+        histogram->SetDirectory(0);
+
+        Products::Histograms::iterator product =
+            products.histograms.find(name);
+
+        if (products.histograms.end() == product)
+        {
+            if (1 != scale)
+            {
+                if (!histogram->GetSumw2N())
+                    histogram->Sumw2();
+
+                histogram->Scale(scale);
+            }
+
+            products.histograms[name] = TH1Ptr(histogram);
+            products.paths.push_back(name);
+
+            continue;
+        }
+
+        product->second->Add(histogram, scale);
+
+        delete histogram;
+    }
+}
+
+void write(TFile *output, const Products &products)
+{
+    for(Products::Paths::const_iterator path = products.paths.begin();
+            products.paths.end() != path;
+            ++path)
+    {
+        TDirectory *directory = output;
+
+        const string::size_type slash = path->rfind('/');
+        if (string::npos != slash)
+        {
+            const string folder = path->substr(0, slash);
+
+            directory = output->GetDirectory(folder.c_str());
+            if (!directory)
+                directory = output->mkdir(folder.c_str());
+
+            if (!directory)
+            {
+                cerr << "failed to create output folder: " << folder << endl;
+
+                continue;
+            }
+        }
+
+        directory->WriteTObject(products.histograms.find(*path)->second.get());
+    }
+}
+
+int main(int argc, char *argv[])
+try
+{
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("output", po::value<string>()->default_value("merged.root"), "output file")
+        ("scale-file", po::value<string>()->default_value(string()), "file with sample scales")
+        ("input", po::value<vector<string> >(), "input file(s): file.root[:scale|:sample]")
+        ;
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map options;
+    po::store(po::command_line_parser(argc, argv).
+            options(desc).
+            positional(positional).
+            run(),
+            options);
+    po::notify(options);
+
+    if (options.count("help")
+            || !options.count("input"))
+    {
+        cout << desc << "\n";
+        return 1;
+    }
+
+    // Missing scales would silently leave samples unscaled
+    //
+    const string scale_file = options["scale-file"].as<string>();
+    if (!scale_file.empty()
+            && !filesystem::exists(scale_file))
+    {
+        cerr << "scale file does not exist: " << scale_file << endl;
+
+        return 1;
+    }
+
+    ThetaScale theta_scale;
+    theta_scale.load(scale_file);
+
+    Products products;
+
+    const vector<string> &inputs = options["input"].as<vector<string> >();
+    for(vector<string>::const_iterator input = inputs.begin();
+            inputs.end() != input;
+            ++input)
+    {
+        smatch matches;
+        if (!regex_match(*input, matches, regex("^(.+?\\.root)(?::(.+))?$")))
+        {
+            cerr << "didn't understand input: " << *input << endl;
+
+            return 1;
+        }
+
+        float scale = 1;
+        if (matches[2].matched)
+        {
+            const string value = matches[2];
+            if (regex_match(value, regex("^[0-9.eE+-]+$")))
+                scale = lexical_cast<float>(value);
+            else if (scale_file.empty())
+            {
+                cerr << "sample scale needs --scale-file: " << *input << endl;
+
+                return 1;
+            }
+            else
+                scale = sampleScale(theta_scale, value);
+        }
+
+        shared_ptr<TFile> file(TFile::Open(matches[1].str().c_str(), "read"));
+        if (!file
+                || !file->IsOpen())
+        {
+            cerr << "failed to open file: " << matches[1] << endl;
+
+            return 1;
+        }
+
+        merge(products, file.get(), "", scale);
+
+        cout << " [+] " << matches[1] << " x " << scale << endl;
+    }
+
+    shared_ptr<TFile> output(new TFile(options["output"].as<string>().c_str(),
+                                       "RECREATE"));
+    if (!output->IsOpen())
+    {
+        cerr << "failed to open output file: "
+            << options["output"].as<string>() << endl;
+
+        return 1;
+    }
+
+    write(output.get(), products);
+
+    cout << products.paths.size() << " histograms merged from "
+        << inputs.size() << " inputs" << endl;
+
+    return 0;
+}
+catch(const std::exception &error)
+{
+    cerr << error.what() << endl;
+
+    return 1;
+}
+catch(...)
+{
+    cerr << "Unknown error" << endl;
+
+    return 1;
+}
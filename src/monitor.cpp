@@ -41,6 +41,11 @@ int main(int argc, char *argv[])
         MonitorAnalyzerPtr analyzer(new MonitorAnalyzer());
         boost::shared_ptr<AppController> app(new AppController());
 
+        boost::shared_ptr<MonitorOptions> monitor_options(new MonitorOptions());
+        monitor_options->setDelegate(analyzer.get());
+
+        app->addOptions(*monitor_options);
+
         app->setAnalyzer(analyzer);
 
         result = app->run(argc, argv);
@@ -53,21 +58,29 @@ int main(int argc, char *argv[])
             char *empty_argv[] = { argv[0] };
             shared_ptr<TRint> root(new TRint("app", &empty_argc, empty_argv));
 
+            shared_ptr<JetCanvas> jet_canvas(new JetCanvas("Jets"));
+            shared_ptr<MuonCanvas> mu_pf_canvas(new MuonCanvas("Particle Flow Muons"));
+            shared_ptr<ElectronCanvas> el_pf_canvas(new ElectronCanvas("Particle Flow Electrons"));
+            shared_ptr<PrimaryVertexCanvas> pv_canvas(new PrimaryVertexCanvas("Primary Vertex"));
+            shared_ptr<MissingEnergyCanvas> met_canvas(new MissingEnergyCanvas("Missing Energy"));
+
+            // Monitors are saved with summaries if these are enabled
+            //
+            if (app->output())
+            {
+                jet_canvas->write(*analyzer->jets(), app->output().get());
+                mu_pf_canvas->write(*analyzer->pfMuons(), app->output().get());
+                el_pf_canvas->write(*analyzer->pfElectrons(), app->output().get());
+                pv_canvas->write(*analyzer->primaryVertices(), app->output().get());
+                met_canvas->write(*analyzer->missingEnergy(), app->output().get());
+            }
+
             if (app->isInteractive())
             {
-                shared_ptr<JetCanvas> jet_canvas(new JetCanvas("Jets"));
                 jet_canvas->draw(*analyzer->jets());
-
-                shared_ptr<MuonCanvas> mu_pf_canvas(new MuonCanvas("Particle Flow Muons"));
                 mu_pf_canvas->draw(*analyzer->pfMuons());
-
-                shared_ptr<ElectronCanvas> el_pf_canvas(new ElectronCanvas("Particle Flow Electrons"));
                 el_pf_canvas->draw(*analyzer->pfElectrons());
-
-                shared_ptr<PrimaryVertexCanvas> pv_canvas(new PrimaryVertexCanvas("Primary Vertex"));
                 pv_canvas->draw(*analyzer->primaryVertices());
-
-                shared_ptr<MissingEnergyCanvas> met_canvas(new MissingEnergyCanvas("Missing Energy"));
                 met_canvas->draw(*analyzer->missingEnergy());
 
                 root->Run();
@@ -60,8 +60,11 @@ int main(int argc, char *argv[])
 
         app->setAnalyzer(analyzer);
 
+        // Registered histograms are written by AppController
+        //
         result = app->run(argc, argv);
-        if (result)
+        if (result
+                && app->isInteractive())
         {
             typedef bsm::stat::TH1Ptr TH1Ptr;
             typedef bsm::stat::TH2Ptr TH2Ptr;
@@ -103,60 +106,51 @@ int main(int argc, char *argv[])
             mreco_vs_mgen->GetYaxis()->SetTitle("m_{t#bar{t}}^{gen} [GeV/c^{2}]");
             mreco_vs_mgen->GetYaxis()->SetTitleSize(0.045);
 
-            if (app->output())
-            {
-                mreco->Write();
-                mltop_vs_mhtop->Write();
-            }
-            
-            if (app->isInteractive())
-            {
-                shared_ptr<TCanvas> canvas(new TCanvas());
-                canvas->SetTitle("Mass");
-                canvas->SetWindowSize(1200, 800);
-                canvas->Divide(3, 2);
+            shared_ptr<TCanvas> canvas(new TCanvas());
+            canvas->SetTitle("Mass");
+            canvas->SetWindowSize(1200, 800);
+            canvas->Divide(3, 2);
 
-                canvas->cd(1);
-                mreco->Draw("h");
+            canvas->cd(1);
+            mreco->Draw("h");
 
-                canvas->cd(2);
-                mgen->Draw("h");
+            canvas->cd(2);
+            mgen->Draw("h");
 
-                canvas->cd(3);
-                mreco_minus_mgen->Draw("h");
+            canvas->cd(3);
+            mreco_minus_mgen->Draw("h");
 
-                canvas->cd(4);
-                canvas->cd(4)->SetLeftMargin(10);
-                mltop_vs_mhtop->Draw("colz");
+            canvas->cd(4);
+            canvas->cd(4)->SetLeftMargin(10);
+            mltop_vs_mhtop->Draw("colz");
 
-                canvas->cd(5);
-                canvas->cd(5)->SetLeftMargin(10);
-                mreco_vs_mgen->Draw("colz");
+            canvas->cd(5);
+            canvas->cd(5)->SetLeftMargin(10);
+            mreco_vs_mgen->Draw("colz");
 
-                canvas->Update();
+            canvas->Update();
 
-                boost::shared_ptr<P4Canvas> met(
-                        new P4Canvas("Reconstructed Missing Energy"));
-                met->draw(*analyzer->missingEnergyMonitor());
+            boost::shared_ptr<P4Canvas> met(
+                    new P4Canvas("Reconstructed Missing Energy"));
+            met->draw(*analyzer->missingEnergyMonitor());
 
-                boost::shared_ptr<P4Canvas> lwboson(
-                        new P4Canvas("Leptonic W-Boson"));
-                lwboson->draw(*analyzer->lwbosonMonitor());
+            boost::shared_ptr<P4Canvas> lwboson(
+                    new P4Canvas("Leptonic W-Boson"));
+            lwboson->draw(*analyzer->lwbosonMonitor());
 
-                boost::shared_ptr<P4Canvas> ltop_p4(
-                        new P4Canvas("Leptonic Top"));
-                ltop_p4->draw(*analyzer->ltopMonitor());
+            boost::shared_ptr<P4Canvas> ltop_p4(
+                    new P4Canvas("Leptonic Top"));
+            ltop_p4->draw(*analyzer->ltopMonitor());
 
-                boost::shared_ptr<P4Canvas> htop_p4(
-                        new P4Canvas("Hadronic Top"));
-                htop_p4->draw(*analyzer->htopMonitor());
+            boost::shared_ptr<P4Canvas> htop_p4(
+                    new P4Canvas("Hadronic Top"));
+            htop_p4->draw(*analyzer->htopMonitor());
 
-                boost::shared_ptr<DeltaCanvas> top_delta(
-                        new DeltaCanvas("Delta between Leptonic and Hadronic tops"));
-                top_delta->draw(*analyzer->topDeltaMonitor());
+            boost::shared_ptr<DeltaCanvas> top_delta(
+                    new DeltaCanvas("Delta between Leptonic and Hadronic tops"));
+            top_delta->draw(*analyzer->topDeltaMonitor());
 
-                root->Run();
-            }
+            root->Run();
         }
     }
     catch(const exception &error)
@@ -92,6 +92,10 @@ private:
     SynchSelectorPtr _synch_selector;
     // Pointer to the bookkeeper (allow the fast creating of histograms)
     HistogramBookkeeperPtr _bookkeeper;
+
+    // Handles to the booked histograms
+    HistogramBookkeeper::H1Handle _loose_pt;
+    HistogramBookkeeper::H1Handle _loose_eta;
 };
 
 }
@@ -77,8 +77,50 @@ public:
 
 private:
 
+    enum Selection
+    {
+        EID = 0,
+        ECONV,
+        EFULL,
+
+        SELECTIONS
+    };
+
+    enum WorkingPoint
+    {
+        ALL = 0,
+        VERY_LOOSE,
+        LOOSE,
+        MEDIUM,
+        TIGHT,
+        SUPER_TIGHT,
+        HYPER_TIGHT1,
+        HYPER_TIGHT2,
+        HYPER_TIGHT3,
+        HYPER_TIGHT4,
+
+        WORKING_POINTS
+    };
+
+    enum Variable
+    {
+        PT = 0,
+        ETA,
+        PHI,
+
+        VARIABLES
+    };
+
+    typedef HistogramBookkeeper::H1Handle Handles[VARIABLES];
+
+    // Fill pt, eta and phi histograms
+    void fill(Handles const &, LorentzVector const &);
+
     SynchSelectorPtr _synch_selector;
     HistogramBookkeeperPtr _bookkeeper;
+
+    // Histograms handles (ECONV and EFULL are not booked for ALL)
+    Handles _handles[SELECTIONS][WORKING_POINTS];
 };
 
 }
@@ -142,6 +142,29 @@ private:
     // Pointer to the book keepper
     HistogramBookkeeperPtr _bookkeeper;
 
+    // Histograms are accessed by handles in the events loop
+    enum Histogram
+    {
+        ALL_TRIGGER_THRESHOLD = 0,
+        ALL_EVENTS_HT,
+        ALL_EVENTS_ELECTRON_PT,
+        TRIGGER_HT200_HT,
+        TRIGGER_ELE8_HT,
+        TRIGGER_CALO_ISO_HT,
+        TRIGGER_ELE25_TRI_CENTRAL_JET30_HT,
+        TRIGGER_ELEX_HT,
+        PASS_TRIGGER_THRESHOLD,
+        TRIGGER_ELEX_ELECTRON_PT,
+        TRIGGER_ELE90_HT,
+        TRIGGER_ELE90_ELECTRON_PT,
+        TRIGGER_FANCY_HT,
+        TRIGGER_FANCY_ELECTRON_PT,
+
+        HISTOGRAMS
+    };
+
+    HistogramBookkeeper::H1Handle _histograms[HISTOGRAMS];
+
     // Use of pileup reweighting
     boost::shared_ptr<Pileup> _pileup;
     bool _use_pileup;
@@ -24,8 +24,9 @@ BookkeeperAnalyzer::BookkeeperAnalyzer()
     // Initializing bookkeeper
     _bookkeeper.reset(new HistogramBookkeeper());
     // Booking histograms (each histograms has to have a unique name)
-    _bookkeeper->book1d("EIDLoosePt", 50, 0, 100);
-    _bookkeeper->book1d("EIDLooseEta", 50, -2.5, 2.5);
+    // Keep the returned handles to access histograms in the events loop
+    _loose_pt = _bookkeeper->book1d("EIDLoosePt", 50, 0, 100);
+    _loose_eta = _bookkeeper->book1d("EIDLooseEta", 50, -2.5, 2.5);
     // Monitor the bookkeeper
     monitor(_bookkeeper);
 
@@ -33,7 +34,9 @@ BookkeeperAnalyzer::BookkeeperAnalyzer()
 }
 
 
-BookkeeperAnalyzer::BookkeeperAnalyzer(const BookkeeperAnalyzer & object)
+BookkeeperAnalyzer::BookkeeperAnalyzer(const BookkeeperAnalyzer & object):
+    _loose_pt(object._loose_pt),
+    _loose_eta(object._loose_eta)
 {
     // Initialize the selector by copy the one in object
     _synch_selector.reset(new SynchSelector(*object._synch_selector));
@@ -41,7 +44,7 @@ BookkeeperAnalyzer::BookkeeperAnalyzer(const BookkeeperAnalyzer & object)
     monitor(_synch_selector);
     // Initialize the bookkeeper by copy the one in object
     _bookkeeper.reset(new HistogramBookkeeper(*object._bookkeeper));
-    // Monitor the new bookkeeper
+    // Monitor the new bookkeeper (handles are valid in the copy)
     monitor(_bookkeeper);
 
     // Note: the order of to declare monitor object has to be the same as in the default constructor
@@ -70,9 +73,9 @@ void BookkeeperAnalyzer::process(const Event *event)
             // Check if the electron has the identification bit for the category tight
             if (electronid.name() == bsm::Electron::Loose && electronid.identification())
             {
-                // Fill the corresponding histograms
-                _bookkeeper->get1d("EIDLoosePt")->fill(pt(electron.physics_object().p4()));
-                _bookkeeper->get1d("EIDLooseEta")->fill(eta(electron.physics_object().p4()));
+                // Fill the corresponding histograms (no look up by name)
+                _bookkeeper->h1(_loose_pt).fill(pt(electron.physics_object().p4()));
+                _bookkeeper->h1(_loose_eta).fill(eta(electron.physics_object().p4()));
             }
         }
     }
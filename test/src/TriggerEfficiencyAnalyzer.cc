@@ -59,20 +59,20 @@ TriggerEfficiencyAnalyzer::TriggerEfficiencyAnalyzer():
     // Initializing bookkeeper (booking histograms)
 
     _bookkeeper.reset(new HistogramBookkeeper());
-    _bookkeeper->book1d("AllTriggerThreshold", 50, 0, 200);
-    _bookkeeper->book1d("AllEventsHT", 50, 400, 1000);
-    _bookkeeper->book1d("AllEventsElectronPT", 50, 100, 400);
-    _bookkeeper->book1d("TriggerHT200HT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerEle8HT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerCaloIsoHT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerEle25TriCentralJet30HT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerEleXHT", 50, 400, 1000);
-    _bookkeeper->book1d("PassTriggerThreshold", 50, 0, 200);
-    _bookkeeper->book1d("TriggerEleXElectronPT", 50, 100, 400);
-    _bookkeeper->book1d("TriggerEle90HT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerEle90ElectronPT", 50, 100, 400);
-    _bookkeeper->book1d("TriggerFancyHT", 50, 400, 1000);
-    _bookkeeper->book1d("TriggerFancyElectronPT", 50, 100, 400);
+    _histograms[ALL_TRIGGER_THRESHOLD] = _bookkeeper->book1d("AllTriggerThreshold", 50, 0, 200);
+    _histograms[ALL_EVENTS_HT] = _bookkeeper->book1d("AllEventsHT", 50, 400, 1000);
+    _histograms[ALL_EVENTS_ELECTRON_PT] = _bookkeeper->book1d("AllEventsElectronPT", 50, 100, 400);
+    _histograms[TRIGGER_HT200_HT] = _bookkeeper->book1d("TriggerHT200HT", 50, 400, 1000);
+    _histograms[TRIGGER_ELE8_HT] = _bookkeeper->book1d("TriggerEle8HT", 50, 400, 1000);
+    _histograms[TRIGGER_CALO_ISO_HT] = _bookkeeper->book1d("TriggerCaloIsoHT", 50, 400, 1000);
+    _histograms[TRIGGER_ELE25_TRI_CENTRAL_JET30_HT] = _bookkeeper->book1d("TriggerEle25TriCentralJet30HT", 50, 400, 1000);
+    _histograms[TRIGGER_ELEX_HT] = _bookkeeper->book1d("TriggerEleXHT", 50, 400, 1000);
+    _histograms[PASS_TRIGGER_THRESHOLD] = _bookkeeper->book1d("PassTriggerThreshold", 50, 0, 200);
+    _histograms[TRIGGER_ELEX_ELECTRON_PT] = _bookkeeper->book1d("TriggerEleXElectronPT", 50, 100, 400);
+    _histograms[TRIGGER_ELE90_HT] = _bookkeeper->book1d("TriggerEle90HT", 50, 400, 1000);
+    _histograms[TRIGGER_ELE90_ELECTRON_PT] = _bookkeeper->book1d("TriggerEle90ElectronPT", 50, 100, 400);
+    _histograms[TRIGGER_FANCY_HT] = _bookkeeper->book1d("TriggerFancyHT", 50, 400, 1000);
+    _histograms[TRIGGER_FANCY_ELECTRON_PT] = _bookkeeper->book1d("TriggerFancyElectronPT", 50, 100, 400);
 
     monitor(_bookkeeper);
 }
@@ -87,6 +87,10 @@ TriggerEfficiencyAnalyzer::TriggerEfficiencyAnalyzer(const TriggerEfficiencyAnal
     monitor(_pileup);
     _bookkeeper.reset(new HistogramBookkeeper(*object._bookkeeper));
     monitor(_bookkeeper);
+
+    // Handles are valid in the bookkeeper copy
+    for (int histogram = 0; histogram < HISTOGRAMS; ++histogram)
+        _histograms[histogram] = object._histograms[histogram];
 }
 
 
@@ -187,14 +191,14 @@ void TriggerEfficiencyAnalyzer::process(const Event *event)
         _synch_selector->niceJets().end() != jet;
         ++jet
     )
-        ht += pt(*jet->corrected_p4);
+        ht += jet->corrected_pt;
     // Adding also the pt of the electron
     ht += electronPt;
 
     // Fill the histogram with all the events
-    _bookkeeper->get1d("AllEventsHT")->fill(ht,weight);
-    _bookkeeper->get1d("AllEventsElectronPT")->fill(electronPt,weight);
-    _bookkeeper->get1d("AllTriggerThreshold")->fill(electronPt,weight);
+    _bookkeeper->h1(_histograms[ALL_EVENTS_HT]).fill(ht,weight);
+    _bookkeeper->h1(_histograms[ALL_EVENTS_ELECTRON_PT]).fill(electronPt,weight);
+    _bookkeeper->h1(_histograms[ALL_TRIGGER_THRESHOLD]).fill(electronPt,weight);
 
     bool elexflag = false;
     bool ele90flag = false;
@@ -205,22 +209,22 @@ void TriggerEfficiencyAnalyzer::process(const Event *event)
             ++hlt)
     {
         if (_hlt_map[hlt->hash()] == "hlt_ht200" && hlt->pass())
-            _bookkeeper->get1d("TriggerHT200HT")->fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_HT200_HT]).fill(ht,weight);
         if (_hlt_map[hlt->hash()] == "hlt_ele8" && hlt->pass())
-            _bookkeeper->get1d("TriggerEle8HT")->fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_ELE8_HT]).fill(ht,weight);
         if (_hlt_map[hlt->hash()] == "hlt_ele8_caloidl_caloisovl" && hlt->pass())
-            _bookkeeper->get1d("TriggerCaloIsoHT")->fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_CALO_ISO_HT]).fill(ht,weight);
         if (_hlt_map[hlt->hash()] == "hlt_ele25_caloidvt_trkidt_centraltrijet30" && hlt->pass())
-            _bookkeeper->get1d("TriggerEle25TriCentralJet30HT")->fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_ELE25_TRI_CENTRAL_JET30_HT]).fill(ht,weight);
         if (_hlt_map[hlt->hash()] == "hlt_ele10_caloidt_caloisovl_trkidt_trkisovl_ht200" && hlt->pass())
         {
-            _bookkeeper->get1d("TriggerFancyHT")->fill(ht,weight);
-            _bookkeeper->get1d("TriggerFancyElectronPT")->fill(electronPt,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_FANCY_HT]).fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_FANCY_ELECTRON_PT]).fill(electronPt,weight);
         }
         if (_hlt_map[hlt->hash()] == "hlt_ele90_nospikefilter" && hlt->pass())
         {
-            _bookkeeper->get1d("TriggerEle90HT")->fill(ht,weight);
-            _bookkeeper->get1d("TriggerEle90ElectronPT")->fill(electronPt,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_ELE90_HT]).fill(ht,weight);
+            _bookkeeper->h1(_histograms[TRIGGER_ELE90_ELECTRON_PT]).fill(electronPt,weight);
             ele90flag = true;
         }        
         if (
@@ -232,12 +236,12 @@ void TriggerEfficiencyAnalyzer::process(const Event *event)
     }
 
     if (elexflag)
-        _bookkeeper->get1d("PassTriggerThreshold")->fill(electronPt,weight);
+        _bookkeeper->h1(_histograms[PASS_TRIGGER_THRESHOLD]).fill(electronPt,weight);
 
     if (elexflag && ele90flag)
     {
-        _bookkeeper->get1d("TriggerEleXHT")->fill(ht,weight);
-        _bookkeeper->get1d("TriggerEleXElectronPT")->fill(electronPt,weight);
+        _bookkeeper->h1(_histograms[TRIGGER_ELEX_HT]).fill(ht,weight);
+        _bookkeeper->h1(_histograms[TRIGGER_ELEX_ELECTRON_PT]).fill(electronPt,weight);
     }
 
     return;
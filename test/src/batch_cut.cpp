@@ -0,0 +1,62 @@
+// Test batch cut apply: compare with per-value apply
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <iostream>
+
+#include <boost/pointer_cast.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "interface/Cut.h"
+#include "interface/Utility.h"
+
+using namespace std;
+using namespace boost;
+using namespace bsm;
+
+int main(int argc, char *argv[])
+{
+    shared_ptr<Cut> cut(new Comparator<>(5, "Per-value Comparator"));
+    shared_ptr<Cut> batch_cut = dynamic_pointer_cast<Cut>(cut->clone());
+    batch_cut->setName("Batch Comparator");
+
+    shared_ptr<Cut> inverted_cut = dynamic_pointer_cast<Cut>(cut->clone());
+    inverted_cut->setName("Inverted Batch Comparator");
+    inverted_cut->invert();
+
+    CutValues values;
+    for(int i = 0; 10 > i; ++i)
+    {
+        cut->apply(i);
+        values.push_back(i);
+    }
+
+    SelectionMask mask(values.size(), 1);
+    const uint32_t selected = batch_cut->apply(values, mask);
+
+    SelectionMask inverted_mask(values.size(), 1);
+    const uint32_t inverted_selected =
+        inverted_cut->apply(values, inverted_mask);
+
+    cout << *cut << endl;
+    cout << *batch_cut << endl;
+    cout << *inverted_cut << endl;
+
+    cout << "selected: " << selected
+        << " inverted: " << inverted_selected << endl;
+
+    cout << "mask:";
+    for(SelectionMask::const_iterator pass = mask.begin();
+            mask.end() != pass;
+            ++pass)
+    {
+        cout << " " << static_cast<int>(*pass);
+    }
+    cout << endl;
+
+    return selected == cut->objects()->counts()
+        && values.size() == selected + inverted_selected
+        ? 0
+        : 1;
+}
@@ -16,6 +16,7 @@ using namespace std;
 using namespace boost;
 
 using bsm::JetPermutation;
+using bsm::JetPermutationTable;
 
 typedef JetPermutation::Jets Jets;
 
@@ -63,6 +64,14 @@ ostream &operator<<(ostream &out, const Jets &jets)
     return out;
 }
 
+ostream &operator<<(ostream &out, const JetPermutation::Indices &indices)
+{
+    for(const uint8_t *index = indices.begin; indices.end != index; ++index)
+        out << *(::jets[*index]) << " ";
+
+    return out;
+}
+
 // This method is used for debugging
 //
 void printJets()
@@ -83,6 +92,13 @@ int main(int argc, char *argv[])
     }
 
     const uint32_t number_of_jets = lexical_cast<uint32_t>(argv[1]);
+    if (JetPermutationTable::MAX_JETS < number_of_jets)
+    {
+        cerr << "at most " << JetPermutationTable::MAX_JETS
+            << " jets are supported" << endl;
+
+        return 1;
+    }
 
     for(uint32_t i = 0; number_of_jets > i; ++i)
     {
@@ -102,8 +118,8 @@ int main(int argc, char *argv[])
     do
     {
         ++total_permutations;
-        Jets leptonic = permutation.leptonicJets();
-        Jets hadronic = permutation.hadronicJets();
+        JetPermutation::Indices leptonic = permutation.leptonic();
+        JetPermutation::Indices hadronic = permutation.hadronic();
         //cout << "Leptonic: " << leptonic << endl;
         //cout << "Hadronic: " << hadronic << endl;
         //cout << endl;
@@ -124,8 +140,8 @@ int main(int argc, char *argv[])
     do
     {
         ++total_permutations;
-        Jets leptonic = permutation.leptonicJets();
-        Jets hadronic = permutation.hadronicJets();
+        JetPermutation::Indices leptonic = permutation.leptonic();
+        JetPermutation::Indices hadronic = permutation.hadronic();
     }
     while(permutation.next());
     end = clock();
@@ -133,6 +149,25 @@ int main(int argc, char *argv[])
     cout << total_permutations << " total permutations were generated" << endl;
     cout << "it took " << double(end - start) / CLOCKS_PER_SEC << " seconds" << endl;
 
+    // Every leg gets at least one jet, the rest of jets are unused. Each
+    // unordered pair is visited twice
+    //
+    uint32_t expected_permutations = 1;
+    for(uint32_t i = 0; number_of_jets > i; ++i)
+        expected_permutations *= 3;
+
+    expected_permutations -= 2 * (1 << number_of_jets) - 1;
+
+    int result = 0;
+    if (1 < number_of_jets
+            && expected_permutations != total_permutations)
+    {
+        cerr << "expected " << expected_permutations << " permutations"
+            << endl;
+
+        result = 1;
+    }
+
     for(Jets::const_iterator jet = ::jets.begin();
             ::jets.end() != jet;
             ++jet)
@@ -140,5 +175,5 @@ int main(int argc, char *argv[])
         delete *jet;
     }
 
-    return 1;
+    return result;
 }
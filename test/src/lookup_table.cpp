@@ -0,0 +1,109 @@
+// Test lookup table: compare bin lookup with linear search
+//
+// Created by agent, Oct 19, 2026
+// Copyright 2026, All rights reserved
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "interface/LookupTable.h"
+
+using namespace std;
+using namespace bsm;
+
+// Bins are (low, high], out of range values use first or last bin
+//
+uint32_t find_bin(const vector<float> &edges, const float &value)
+{
+    uint32_t bin = 0;
+    for(vector<float>::const_iterator edge = edges.begin() + 1;
+            edges.end() - 1 != edge && *edge < value;
+            ++edge, ++bin);
+
+    return bin;
+}
+
+int main(int argc, char *argv[])
+{
+    const float bins[] = {
+        30, 40, 50, 60, 70, 80, 100, 120, 160, 210, 260, 320, 400, 500, 670
+    };
+
+    const vector<float> edges(bins, bins + 15);
+
+    LookupTable table(LookupAxis(edges, LookupAxis::UPPER_INCLUSIVE));
+
+    vector<float> values;
+    for(uint32_t bin = 0; table.bins() > bin; ++bin)
+        values.push_back(bin);
+
+    table.set(LookupTable::NOMINAL, values);
+
+    uint32_t failures = 0;
+    for(float pt = 0; 1000 > pt; pt += 0.5)
+    {
+        if (find_bin(edges, pt) != table.value(pt))
+        {
+            cerr << "pt: " << pt << " expected bin " << find_bin(edges, pt)
+                << " got " << table.value(pt) << endl;
+
+            ++failures;
+        }
+    }
+
+    // Non-finite and huge values are clamped without overflow
+    //
+    const LookupAxis uniform(10, 0, 10);
+    const float nan = numeric_limits<float>::quiet_NaN();
+    const float infinity = numeric_limits<float>::infinity();
+    if (0 != uniform.find(nan)
+            || 0 != uniform.find(-infinity)
+            || 0 != uniform.find(-1e30)
+            || 9 != uniform.find(infinity)
+            || 9 != uniform.find(1e30)
+            || 0 != table.value(nan))
+    {
+        cerr << "out of range values are not clamped" << endl;
+
+        ++failures;
+    }
+
+    // 3D uniform table loaded from text: value is the flat index
+    //
+    LookupTable table3d(LookupAxis(3, 0, 3),
+            LookupAxis(4, 0, 4),
+            LookupAxis(5, 0, 5));
+
+    ostringstream text;
+    text << "# comment line" << endl;
+    for(uint32_t bin = 0; table3d.bins() > bin; ++bin)
+        text << bin << " ";
+    text << endl;
+
+    istringstream in(text.str());
+    if (!table3d.load(LookupTable::UP, in))
+        ++failures;
+
+    for(uint32_t x = 0; 4 > x; ++x)
+        for(uint32_t y = 0; 5 > y; ++y)
+            for(uint32_t z = 0; 6 > z; ++z)
+            {
+                const uint32_t bin = (min(x, 2u) * 4 + min(y, 3u)) * 5
+                    + min(z, 4u);
+
+                if (bin != table3d.value(x, y, z, LookupTable::UP))
+                {
+                    cerr << "(" << x << ", " << y << ", " << z
+                        << ") expected " << bin << " got "
+                        << table3d.value(x, y, z, LookupTable::UP) << endl;
+
+                    ++failures;
+                }
+            }
+
+    cout << "failures: " << failures << endl;
+
+    return failures ? 1 : 0;
+}